@@ -104,7 +104,11 @@ namespace CASM {
 
     //for derived accept method, always do:
     //accept(const FunctionVisitor &visitor){Function::accept(visitor); visitor->visit(*this);}
-    bool accept(const FunctionVisitor &visitor, BasisSet const *home_basis_ptr = NULL);
+    //trivial forwarder to the virtual _accept; inline so that visitation of
+    //large Function trees pays one dynamic dispatch per node, not two calls
+    bool accept(const FunctionVisitor &visitor, BasisSet const *home_basis_ptr = NULL) {
+      return _accept(visitor, home_basis_ptr);
+    }
     virtual void small_to_zero(double tol = TOL) = 0;
     virtual Index num_terms() const = 0;
     virtual double leading_coefficient() const = 0;
@@ -51,21 +51,17 @@ namespace CASM {
     }
 
     std::string type_name_prefix() const {
-      std::vector<std::string> split_string;
-      boost::split(split_string, type_name(), boost::is_any_of("_"), boost::token_compress_on);
-      if(split_string.size())
-        return split_string[0];
-      else
-        return std::string();
+      // portion of type_name() before the first '_', without tokenizing the
+      // whole name into a temporary vector of strings
+      return type_name().substr(0, type_name().find('_'));
     }
 
     std::string type_name_suffix() const {
-      std::vector<std::string> split_string;
-      boost::split(split_string, type_name(), boost::is_any_of("_"), boost::token_compress_on);
-      if(split_string.size())
-        return split_string.back();
-      else
-        return std::string();
+      // portion of type_name() after the last '_'
+      std::string::size_type pos = type_name().rfind('_');
+      if(pos == std::string::npos)
+        return type_name();
+      return type_name().substr(pos + 1);
     }
 
     Index ID() const {
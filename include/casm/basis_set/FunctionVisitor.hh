@@ -4,6 +4,7 @@
 #include <iostream>
 #include <sstream>
 #include <map>
+#include <vector>
 #include "casm/CASM_global_definitions.hh"
 #include "casm/container/Array.hh"
 
@@ -46,6 +47,43 @@ namespace CASM {
 
   };
 
+  //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+  /// One piece of a labeler template string, produced by parsing the template
+  /// once at construction. Placeholders ("%n", "%f", etc.) are tagged by kind
+  /// so that visit() dispatches on an enum instead of re-comparing substrings
+  /// for every Function it relabels. Placeholders that a particular labeler
+  /// does not interpret keep their original text and are emitted verbatim.
+  struct FormulaToken {
+    enum Kind {LITERAL, NLIST_IND, FUNC_IND, BASIS_IND, TYPE_PREFIX, TYPE_SUFFIX};
+
+    Kind kind;
+    std::string text;
+
+    FormulaToken() : kind(LITERAL) {}
+
+    FormulaToken(Kind _kind, const std::string &_text) : kind(_kind), text(_text) {}
+
+    /// Map a two-character placeholder ("%n", "%f", "%b", "%p", "%s") to its
+    /// kind; anything unrecognized is kept as a LITERAL
+    static Kind placeholder_kind(const std::string &_tag) {
+      if(_tag.size() == 2) {
+        switch(_tag[1]) {
+        case 'n':
+          return NLIST_IND;
+        case 'f':
+          return FUNC_IND;
+        case 'b':
+          return BASIS_IND;
+        case 'p':
+          return TYPE_PREFIX;
+        case 's':
+          return TYPE_SUFFIX;
+        }
+      }
+      return LITERAL;
+    }
+  };
+
   //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
   /// Selectively relabel all OccupantFunctions in a Function tree, using their
   /// set_formula() method. OccFuncLabeler is constructed using a template string,
@@ -57,8 +95,10 @@ namespace CASM {
 
 
   class OccFuncLabeler : public FunctionVisitor {
-    Array<std::string> m_sub_strings;
-    mutable std::stringstream m_ss;
+    std::vector<FormulaToken> m_tokens;
+    ///scratch buffer reused across visits, so each relabel appends into
+    ///already-allocated storage instead of running a stringstream
+    mutable std::string m_str;
   public:
     OccFuncLabeler(const std::string &_template);
 
@@ -95,8 +135,7 @@ namespace CASM {
 
 
   class VariableLabeler : public FunctionVisitor {
-    Array<std::string> m_sub_strings;
-    mutable std::stringstream m_ss;
+    std::vector<FormulaToken> m_tokens;
   public:
     VariableLabeler(const std::string &_template);
 
@@ -110,8 +149,9 @@ namespace CASM {
   //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
   class SubExpressionLabeler : public FunctionVisitor {
     std::string m_bset_name;
-    Array<std::string> m_sub_strings;
-    mutable std::stringstream m_ss;
+    std::vector<FormulaToken> m_tokens;
+    ///scratch buffer reused across visits (see OccFuncLabeler)
+    mutable std::string m_str;
   public:
     SubExpressionLabeler(const std::string &_bset_name, const std::string &_template);
 
@@ -176,7 +176,7 @@ namespace CASM {
 
         /// \brief Append atom name to end of each coordinate line
         void set_append_atom_names_on() {
-          m_append_atom_names = false;
+          m_append_atom_names = true;
         }
 
         /// \brief Access vector of atom names which should not be printed, such as for vacancies
@@ -192,9 +192,11 @@ namespace CASM {
 
       protected:
 
-        /// \brief Print POSCAR, provide a range of std::tuple<Atom name, Coordinate, SelectiveDynamics>
-        template<typename TupleIterator>
-        void _print(std::ostream &sout, TupleIterator begin, TupleIterator end);
+        /// \brief Print POSCAR, provide aligned vectors of atom name, Coordinate, and SelectiveDynamics
+        void _print(std::ostream &sout,
+                    const std::vector<std::string> &name,
+                    const std::vector<Coordinate> &coord,
+                    const std::vector<SelectiveDynamics> &sel_dynamics);
 
       private:
 
@@ -235,14 +237,6 @@ namespace CASM {
 
       typedef std::string AtomName;
 
-      /// \brief Atom name, Coordinate, SelectiveDynamics
-      typedef std::tuple<AtomName, Coordinate, SelectiveDynamics> tuple_type;
-
-      typedef std::vector<tuple_type>::iterator iterator;
-
-      typedef std::vector<tuple_type>::const_iterator const_iterator;
-
-
       /// \brief Construct PrintPOSCAR object
       PrintPOSCAR(const BasicStructure<Site> &struc);
 
@@ -252,26 +246,6 @@ namespace CASM {
       /// \brief Construct PrintPOSCAR object
       PrintPOSCAR(const Supercell &scel, const ConfigDoF &configdof);
 
-      /// \brief Iterate over tuples of (AtomName, Coordinate, SelectiveDynamics)
-      iterator begin() {
-        return m_atom_order.begin();
-      }
-
-      /// \brief Iterate over tuples of (AtomName, Coordinate, SelectiveDynamics)
-      iterator end() {
-        return m_atom_order.end();
-      }
-
-      /// \brief Iterate over tuples of (AtomName, Coordinate, SelectiveDynamics)
-      const_iterator cbegin() const {
-        return m_atom_order.cbegin();
-      }
-
-      /// \brief Iterate over tuples of (AtomName, Coordinate, SelectiveDynamics)
-      const_iterator cend() const {
-        return m_atom_order.cend();
-      }
-
       /// \brief Default sort is by atom name
       void sort();
 
@@ -281,8 +255,18 @@ namespace CASM {
 
     private:
 
-      /// \brief (AtomName, Coordinate, SelectiveDynamics)
-      std::vector<tuple_type> m_atom_order;
+      /// Per-atom data, stored as parallel vectors so that each pass over the
+      /// structure (name filtering, species counting, coordinate output)
+      /// streams a single contiguous array
+
+      /// \brief Atom name for each site
+      std::vector<AtomName> m_name;
+
+      /// \brief Coordinate for each site
+      std::vector<Coordinate> m_coord;
+
+      /// \brief SelectiveDynamics setting for each site
+      std::vector<SelectiveDynamics> m_sd;
 
     };
 
@@ -291,32 +275,40 @@ namespace CASM {
 
     namespace vaspio_impl {
 
-      /// \brief Print POSCAR, providing a range of std::tuple<AtomName, Coordinate, SelectiveDynamics>
-      template<typename TupleIterator>
-      void PrintPOSCARBase::_print(std::ostream &sout,
-                                   TupleIterator begin,
-                                   TupleIterator end) {
+      /// \brief Print POSCAR, providing aligned vectors of atom name, Coordinate, and SelectiveDynamics
+      inline void PrintPOSCARBase::_print(std::ostream &sout,
+                                          const std::vector<std::string> &name,
+                                          const std::vector<Coordinate> &coord,
+                                          const std::vector<SelectiveDynamics> &sel_dynamics) {
 
         int tprec = sout.precision();
         std::ios::fmtflags tflags = sout.flags();
         sout.precision(8);
 
-        typedef std::tuple<std::string, Coordinate, SelectiveDynamics> tuple_type;
-
-        // first filter out all atoms we are going to ignore, the remaining atoms get put in 'atom'
-        std::vector<tuple_type> atom;
-        for(auto it = begin; it != end; ++it) {
-
-          // if Atom's name is not found in the ignore list, add it to 'atom'
-          if(m_ignore.cend() == std::find_if(m_ignore.cbegin(),
-                                             m_ignore.cend(),
-          [&](const std::string & name) {
-          if(std::get<0>(*it) == name) {
-              return true;
+        // sort the ignore list once so the per-atom membership test below is
+        // a binary search instead of a linear scan with string compares
+        std::vector<std::string> ignore(m_ignore);
+        std::sort(ignore.begin(), ignore.end());
+
+        // filter out all atoms we are going to ignore and count the species
+        // groups in a single pass; only indices are collected, so no per-atom
+        // data is copied
+        std::vector<Index> keep;
+        keep.reserve(name.size());
+        std::vector<std::string> atom_name;
+        std::vector<int> atom_count;
+        for(Index i = 0; i < name.size(); i++) {
+
+          // if Atom's name is not found in the ignore list, keep it
+          if(!std::binary_search(ignore.cbegin(), ignore.cend(), name[i])) {
+            if(keep.size() == 0 || name[keep.back()] != name[i]) {
+              atom_name.push_back(name[i]);
+              atom_count.push_back(1);
+            }
+            else {
+              atom_count.back()++;
             }
-            return false;
-          })) {
-            atom.push_back(*it);
+            keep.push_back(i);
           }
         }
 
@@ -331,31 +323,15 @@ namespace CASM {
         sout << ' ' << std::setw(16) << m_lat[2].transpose() << '\n';
 
         // if after filtering out ignored atoms none are left, return
-        if(atom.size() == 0) {
+        if(keep.size() == 0) {
           return;
         }
 
-        // count number each atom, and optionally print atom names line
-        std::vector<int> atom_count = {1};
-        auto it = atom.cbegin();
-        std::string curr_atom = std::get<0>(*it);
+        // optionally print atom names line
         if(m_atom_names) {
-          sout << curr_atom << " ";
-        }
-        ++it;
-        for(; it != atom.cend(); ++it) {
-          if(std::get<0>(*it) != curr_atom) {
-            atom_count.push_back(1);
-            curr_atom = std::get<0>(*it);
-            if(m_atom_names) {
-              sout << curr_atom << " ";
-            }
+          for(Index i = 0; i < atom_name.size(); i++) {
+            sout << atom_name[i] << " ";
           }
-          else {
-            atom_count.back()++;
-          }
-        }
-        if(m_atom_names) {
           sout << "\n";
         }
 
@@ -373,13 +349,13 @@ namespace CASM {
         sout << COORD_MODE::NAME(m_coord_mode) << "\n";
 
         // print all coordinates, and seletive dynamics settings, and atom names if applicable
-        for(auto it = atom.cbegin(); it != atom.cend(); ++it) {
-          std::get<1>(*it).print(sout, m_coord_mode);
+        for(auto it = keep.cbegin(); it != keep.cend(); ++it) {
+          coord[*it].print(sout, m_coord_mode);
           if(m_sel_dynamics) {
-            sout << " " << std::get<2>(*it);
+            sout << " " << sel_dynamics[*it];
           }
           if(m_append_atom_names) {
-            sout << " " << std::get<0>(*it);
+            sout << " " << name[*it];
           }
           sout << "\n";
         }
@@ -412,16 +388,14 @@ namespace CASM {
 
       set_title(struc.title);
 
-      // create tuples collecting (Atom name, Coordinate, SelectiveDynamics) for each site
+      // collect (Atom name, Coordinate, SelectiveDynamics) for each site
+      m_name.reserve(struc.basis.size());
+      m_coord.reserve(struc.basis.size());
       for(int i = 0; i < struc.basis.size(); ++i) {
-        m_atom_order.push_back(
-          tuple_type(
-            struc.basis[i].occ_name(),
-            struc.basis[i],
-            SelectiveDynamics()
-          )
-        );
+        m_name.push_back(struc.basis[i].occ_name());
+        m_coord.push_back(struc.basis[i]);
       }
+      m_sd.assign(struc.basis.size(), SelectiveDynamics());
     }
 
     /// \brief Construct PrintPOSCAR object
@@ -446,16 +420,21 @@ namespace CASM {
 
       const Supercell &scel = config.get_supercell();
 
-      // create tuples collecting (Atom name, Coordinate, SelectiveDynamics) for each site
+      // get occupant name for site i; basis is resolved once instead of
+      // being re-walked through the prim for every site (as get_mol does)
+      const Array<Site> &basis = scel.get_prim().basis;
+      auto occ_name = [&](int i) -> const std::string & {
+        return basis[scel.get_b(i)].site_occupant()[config.occ(i)].name;
+      };
+
+      // collect (Atom name, Coordinate, SelectiveDynamics) for each site
+      m_name.reserve(config.size());
+      m_coord.reserve(config.size());
       for(int i = 0; i < config.size(); ++i) {
-        m_atom_order.push_back(
-          tuple_type(
-            config.get_mol(i).name,
-            scel.coord(i), // no displacement yet
-            SelectiveDynamics()
-          )
-        );
+        m_name.push_back(occ_name(i));
+        m_coord.push_back(scel.coord(i)); // no displacement yet
       }
+      m_sd.assign(config.size(), SelectiveDynamics());
 
     }
 
@@ -477,37 +456,59 @@ namespace CASM {
     inline PrintPOSCAR::PrintPOSCAR(const Supercell &scel, const ConfigDoF &configdof) :
       vaspio_impl::PrintPOSCARBase(scel.get_real_super_lattice()) {
 
-      // get occupant name for site i in configdof
-      auto occ_name = [&](int i) {
-        return scel.get_prim().basis[scel.get_b(i)].site_occupant()[configdof.occ(i)].name;
+      // get occupant name for site i in configdof; basis is resolved once
+      // instead of being re-walked through scel.get_prim() per site
+      const Array<Site> &basis = scel.get_prim().basis;
+      auto occ_name = [&](int i) -> const std::string & {
+        return basis[scel.get_b(i)].site_occupant()[configdof.occ(i)].name;
       };
 
-      // create tuples collecting (Atom name, Coordinate, SelectiveDynamics) for each site
+      // collect (Atom name, Coordinate, SelectiveDynamics) for each site
+      m_name.reserve(configdof.size());
+      m_coord.reserve(configdof.size());
       for(int i = 0; i < configdof.size(); ++i) {
-        m_atom_order.push_back(
-          tuple_type(
-            occ_name(i),
-            scel.coord(i), // no displacement yet
-            SelectiveDynamics()
-          )
-        );
+        m_name.push_back(occ_name(i));
+        m_coord.push_back(scel.coord(i)); // no displacement yet
       }
+      m_sd.assign(configdof.size(), SelectiveDynamics());
 
     }
 
 
     /// \brief Default sort is by species name
+    ///
+    /// Sorts a permutation of the site indices by name, then applies it to
+    /// each of the parallel per-atom vectors
     inline void PrintPOSCAR::sort() {
-      std::sort(m_atom_order.begin(),
-                m_atom_order.end(),
-      [ = ](const tuple_type & A, const tuple_type & B) {
-        return std::get<0>(A) < std::get<0>(B);
+      std::vector<Index> perm(m_name.size());
+      for(Index i = 0; i < perm.size(); i++) {
+        perm[i] = i;
+      }
+      std::stable_sort(perm.begin(),
+                       perm.end(),
+      [&](Index A, Index B) {
+        return m_name[A] < m_name[B];
       });
+
+      std::vector<AtomName> tname;
+      std::vector<Coordinate> tcoord;
+      std::vector<SelectiveDynamics> tsd;
+      tname.reserve(perm.size());
+      tcoord.reserve(perm.size());
+      tsd.reserve(perm.size());
+      for(Index i = 0; i < perm.size(); i++) {
+        tname.push_back(std::move(m_name[perm[i]]));
+        tcoord.push_back(m_coord[perm[i]]);
+        tsd.push_back(m_sd[perm[i]]);
+      }
+      m_name.swap(tname);
+      m_coord.swap(tcoord);
+      m_sd.swap(tsd);
     }
 
     /// \brief Print POSCAR to stream
     inline void PrintPOSCAR::print(std::ostream &sout) {
-      _print(sout, m_atom_order.begin(), m_atom_order.end());
+      _print(sout, m_name, m_coord, m_sd);
     }
 
   }
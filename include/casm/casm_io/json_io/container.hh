@@ -171,16 +171,20 @@ namespace CASM {
   //namespace Eigen {
 
   /// \brief Write Eigen Matrix/Vector to JSON
+  ///
+  /// Rows are built in place in the presized outer array, rather than being
+  /// assembled in a temporary and copied in one row at a time
   template <typename Derived>
   CASM::jsonParser &to_json(const Eigen::MatrixBase<Derived> &value, CASM::jsonParser &json) {
     json.put_array();
+    json.get_array().reserve(value.rows());
     for(int i = 0; i < value.rows(); i++) {
-      CASM::jsonParser json_row;
-      json_row.put_array();
+      json.push_back(CASM::jsonParser::array());
+      CASM::jsonParser &json_row = json[i];
+      json_row.get_array().reserve(value.cols());
       for(int j = 0; j < value.cols(); j++) {
         json_row.push_back(value(i, j));
       }
-      json.push_back(json_row);
     }
     return json;
   }
@@ -190,6 +194,7 @@ namespace CASM {
   template <typename Derived>
   CASM::jsonParser &to_json_array(const Eigen::MatrixBase<Derived> &value, CASM::jsonParser &json) {
     json.put_array();
+    json.get_array().reserve(value.size());
     if(value.rows() == 1) {
       for(int i = 0; i < value.cols(); ++i) {
         json.push_back(value(0, i));
@@ -220,8 +225,9 @@ namespace CASM {
     else {
       value.derived().resize(json.size(), json[0].size());
       for(int i = 0; i < value.rows(); i++) {
+        const CASM::jsonParser &json_row = json[i];
         for(int j = 0; j < value.cols(); j++) {
-          from_json(value(i, j), json[i][j]);
+          from_json(value(i, j), json_row[j]);
         }
       }
     }
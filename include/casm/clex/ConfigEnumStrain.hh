@@ -56,6 +56,15 @@ namespace CASM {
     std::vector<Eigen::MatrixXd> m_trans_mats;
     PermuteIterator m_perm_begin, m_perm_end;
     Eigen::MatrixXd m_shape_factor;
+    //m_shape_factor projected into the subspace of m_trans_mats[m_equiv_ind];
+    //recomputed only when m_equiv_ind changes, so the counter loops evaluate
+    //a single quadratic form per candidate strain state
+    Eigen::MatrixXd m_equiv_shape_factor;
+
+    /// Recompute m_equiv_shape_factor for the current m_equiv_ind
+    void _set_equiv_shape_factor() {
+      m_equiv_shape_factor = m_trans_mats[m_equiv_ind].transpose() * m_shape_factor * m_trans_mats[m_equiv_ind];
+    }
 
     const PermuteIterator &_perm_begin() {
       return m_perm_begin;
@@ -179,6 +179,18 @@ namespace CASM {
   /// \relates ScelEnumT
   typedef ScelEnumT<false> ScelEnum;
 
+
+  // explicit instantiations live in ScelEnum.cc; suppress implicit
+  // re-instantiation in every translation unit that includes ScelEnum_impl.hh
+  extern template class ScelEnumByNameT<true>;
+  extern template class ScelEnumByNameT<false>;
+
+  extern template class ScelEnumByPropsT<true>;
+  extern template class ScelEnumByPropsT<false>;
+
+  extern template class ScelEnumT<true>;
+  extern template class ScelEnumT<false>;
+
 }
 
 /** @}*/
@@ -43,6 +43,7 @@ namespace CASM {
     RandomAccessEnumeratorBase<Supercell, IsConst>(),
     m_primclex(&primclex) {
 
+    m_scelptr.reserve(std::distance(begin, end));
     for(auto it = begin; it != end; ++it) {
       m_scelptr.push_back(&m_primclex->get_supercell(*it));
     }
@@ -142,6 +142,10 @@ namespace CASM {
     /// Store a pointer to the canonical equivalent Supercell
     mutable Supercell *m_canonical;
 
+    /// Store the canonicalizing SymOp, mutable for lazy computation;
+    /// the super lattice never changes, so this is computed at most once
+    mutable notstd::cloneable_ptr<SymOp> m_to_canonical;
+
     // Could hold either enumerated configurations or any 'saved' configurations
     ConfigList config_list;
 
@@ -105,11 +105,11 @@ namespace CASM {
     void calc_properties();  //Alex do this
     void calc_properties(GenericCluster<CoordType> phenom_clust);
 
-    double max_length() const {
+    double max_length() const noexcept {
       return m_max_length;
     }
 
-    double min_length() const {
+    double min_length() const noexcept {
       return m_min_length;
     }
 
@@ -93,11 +93,11 @@ namespace CASM {
     SymGroupRep const *get_full_coord_representation();
 
     /// return max_length of clusters in Orbit
-    double max_length() const {
+    double max_length() const noexcept {
       return prototype.max_length();
     }
     /// return min_length of clusters in Orbit
-    double min_length() const {
+    double min_length() const noexcept {
       return prototype.min_length();
     }
 
@@ -118,12 +118,12 @@ namespace CASM {
     ReturnArray<std::string> delta_occfunc_flower_function_cpp_strings(BasisSet site_basis, const Array<FunctionVisitor *> &labelers, Index nlist_index, Index b_index, Index f_index);
 
     //Access index, which is private
-    Index get_index() const {
+    Index get_index() const noexcept {
       return this->index;
     };
 
     //Allows you to set the index since it's private
-    void set_index(Index ind) const { //Added by Ivy 05/05/2013 -- This may be a temporary fix depending on how we want to treat index
+    void set_index(Index ind) const noexcept { //Added by Ivy 05/05/2013 -- This may be a temporary fix depending on how we want to treat index
       this->index = ind;
     };
 
@@ -148,20 +148,42 @@ namespace CASM {
 
   template<typename ClustType>
   void GenericOrbitBranch<ClustType>::sort() {
-    for(Index i = 0; i < size(); i++) { //Loops over the inner array, which is the subset of all the same-sized clusters
-      for(Index j = i + 1; j < size(); j++) { //Takes the next-in-line of the  inner array and compares it
-        //	  if(orbit(i).prototype.max_length > orbit(j).prototype.max_length){
-        if(std::abs(orbit(i).max_length() - orbit(j).max_length()) < TOL && orbit(i).min_length() > orbit(j).min_length()) {
-          GenericOrbit<ClustType> torbit(orbit(j));
-          orbit(j) = orbit(i);
-          orbit(i) = torbit;
-        }
-        else if(orbit(i).max_length() > orbit(j).max_length() + TOL) {
-          GenericOrbit<ClustType> torbit(orbit(j));
-          orbit(j) = orbit(i);
-          orbit(i) = torbit;
-        }
+    // Sort by precomputed (max_length, min_length) keys. Comparing and
+    // swapping whole Orbits made the old pairwise loop O(N^2) Orbit copies;
+    // sorting lightweight keys and applying the permutation afterward costs
+    // one Orbit copy per cycle element instead.
+    typedef std::pair<std::pair<double, double>, Index> KeyType;
+    std::vector<KeyType> keys;
+    keys.reserve(size());
+    for(Index i = 0; i < size(); i++) {
+      keys.push_back(KeyType(std::make_pair(orbit(i).max_length(), orbit(i).min_length()), i));
+    }
+
+    std::stable_sort(keys.begin(), keys.end(),
+    [](const KeyType & A, const KeyType & B) {
+      if(A.first.first < B.first.first - TOL)
+        return true;
+      if(B.first.first < A.first.first - TOL)
+        return false;
+      return A.first.second < B.first.second;
+    });
+
+    // apply the permutation by following cycles, one temporary per cycle
+    std::vector<bool> placed(size(), false);
+    for(Index i = 0; i < size(); i++) {
+      if(placed[i] || keys[i].second == i) {
+        placed[i] = true;
+        continue;
+      }
+      GenericOrbit<ClustType> torbit(orbit(i));
+      Index j = i;
+      while(keys[j].second != i) {
+        orbit(j) = orbit(keys[j].second);
+        placed[j] = true;
+        j = keys[j].second;
       }
+      orbit(j) = torbit;
+      placed[j] = true;
     }
   }
   //*******************************
@@ -83,11 +83,16 @@ namespace CASM {
     SymGroupRepID perm_rep_ID(sym_group.add_empty_representation());
     prototype.set_permute_rep(perm_rep_ID);
     at(0).set_permute_rep(perm_rep_ID);
-    for(j = 0; j < prototype.clust_group().size(); j++)
+    const Index cg_size = prototype.clust_group().size();
+    for(j = 0; j < cg_size; j++)
       prototype.clust_group()[j].set_rep(perm_rep_ID, SymPermutation(proto_perms[j]));
     for(i = 1; i < size(); i++) {
+      // each row of equivalence_map ends up with one entry per clust_group
+      // operation; reserve so the row is allocated once instead of growing
+      // push_back by push_back
+      equivalence_map[i].reserve(cg_size);
       equivalence_map[i][0].set_rep(perm_rep_ID, SymPermutation(proto_perms[0]));
-      for(j = 1; j < prototype.clust_group().size(); j++) {
+      for(j = 1; j < cg_size; j++) {
         equivalence_map[i].push_back(equivalence_map[i][0]*prototype.clust_group()[j]);
         equivalence_map[i][j].set_rep(perm_rep_ID, SymPermutation(proto_perms[j]));
       }
@@ -122,6 +127,11 @@ namespace CASM {
 
   template<typename ClustType>
   bool GenericOrbit<ClustType>::contains(const ClustType  &test_clust, double tol) const {
+    //size is a translation- and symmetry-invariant key, so a mismatch rules
+    //out every element at once -- before paying for the working copy below
+    if(size() && at(0).size() != test_clust.size())
+      return false;
+
     ClustType  tclust(test_clust);
     for(Index i = 0; i < size(); i++) {
       if(tclust.map_onto(at(i), tol)) {
@@ -154,6 +164,10 @@ namespace CASM {
 
   template<typename ClustType>
   Index GenericOrbit<ClustType>::find(const ClustType  &test_clust, double tol) const {
+    //see contains() -- a size mismatch rules out every element at once
+    if(size() && at(0).size() != test_clust.size())
+      return size();
+
     Index i;
     ClustType  tclust(test_clust);
     for(i = 0; i < size(); i++) {
@@ -172,6 +186,11 @@ namespace CASM {
   Index GenericOrbit<ClustType>::find(const ClustType  &test_clust, Coordinate &trans, double tol) const {
     Index i;
     trans.frac() = Eigen::Vector3d::Zero();
+
+    //see contains() -- a size mismatch rules out every element at once
+    if(size() && at(0).size() != test_clust.size())
+      return size();
+
     ClustType tclust(test_clust);
     for(i = 0; i < size(); i++) {
       if(tclust.map_onto(at(i), trans, tol)) {
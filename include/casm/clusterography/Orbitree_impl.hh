@@ -299,6 +299,9 @@ namespace CASM {
   template<typename ClustType>
   bool GenericOrbitree<ClustType>::contains(const ClustType &test_clust) {
     for(Index i = 0; i < size(); i++) {
+      //test_clust can only live in an OrbitBranch of matching cluster size
+      if(at(i).num_sites() != test_clust.size())
+        continue;
       if(find(test_clust, i) < at(i).size())
         return true;
     }
@@ -4,6 +4,7 @@
 
 #include <iostream>
 #include <cassert>
+#include <algorithm>
 #include <new>
 #include <stdlib.h>
 
@@ -864,33 +865,42 @@ namespace CASM {
 
   template<typename T>
   void Array<T>::sort(Array<Index> &ind_order) {
+    // sort an index permutation first, then apply it to the values; this
+    // replaces the old O(N^2) pairwise scan with O(N log N) comparisons and
+    // moves each value at most once per permutation cycle
     ind_order.clear();
+    ind_order.reserve(size());
     for(Index i = 0; i < size(); i++)
       ind_order.push_back(i);
 
+    std::stable_sort(ind_order.begin(), ind_order.end(),
+    [this](Index a, Index b) {
+      return at(a) < at(b);
+    });
+
+    Array<bool> placed(size(), false);
     for(Index i = 0; i < size(); i++) {
-      for(Index j = i + 1; j < size(); j++) {
-        if(at(j) < at(i)) {
-          swap_elem(i, j);
-          ind_order.swap_elem(i, j);
-        }
+      if(placed[i] || ind_order[i] == i) {
+        placed[i] = true;
+        continue;
+      }
+      T tval(at(i));
+      Index j = i;
+      while(ind_order[j] != i) {
+        at(j) = at(ind_order[j]);
+        placed[j] = true;
+        j = ind_order[j];
       }
+      at(j) = tval;
+      placed[j] = true;
     }
-
   }
 
   //*******************************************************************************************
 
   template<typename T>
   void Array<T>::sort() {
-    for(Index i = 0; i < size(); i++) {
-      for(Index j = i + 1; j < size(); j++) {
-        if(at(j) < at(i)) {
-          swap_elem(i, j);
-        }
-      }
-    }
-
+    std::sort(begin(), end());
   }
   //*******************************************************************************************
   template<typename T>
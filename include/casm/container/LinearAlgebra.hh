@@ -59,9 +59,12 @@ namespace CASM {
   /// \brief Check if Eigen::Matrix is integer
   template<typename Derived>
   bool is_integer(const Eigen::MatrixBase<Derived> &M, double tol) {
-    for(Index i = 0; i < M.rows(); i++) {
-      for(Index j = 0; j < M.cols(); j++) {
-        if(!almost_zero(boost::math::lround(M(i, j)) - M(i, j), tol))
+    //traverse in storage (column-major) order, and use std::round rather
+    //than boost's range-checked rounding, since this check runs for every
+    //candidate in the supercell and lattice mapping loops
+    for(Index j = 0; j < M.cols(); j++) {
+      for(Index i = 0; i < M.rows(); i++) {
+        if(!almost_zero(std::round(M(i, j)) - M(i, j), tol))
           return false;
       }
     }
@@ -185,6 +188,32 @@ namespace CASM {
     return cofactor(M).transpose();
   }
 
+  /// \brief Return adjugate matrix of a 3x3 matrix
+  ///
+  /// \returns adjugate matrix
+  ///
+  /// \param M 3x3 matrix
+  ///
+  /// Overload with the nine cofactors written out directly, avoiding the
+  /// submatrix construction of the generic version. 3x3 adjugates are taken
+  /// for every supercell transformation matrix during enumeration, so this
+  /// path is worth special-casing.
+  ///
+  template<typename Scalar>
+  Eigen::Matrix<Scalar, 3, 3> adjugate(const Eigen::Matrix<Scalar, 3, 3> &M) {
+    Eigen::Matrix<Scalar, 3, 3> adj;
+    adj(0, 0) = M(1, 1) * M(2, 2) - M(1, 2) * M(2, 1);
+    adj(0, 1) = M(0, 2) * M(2, 1) - M(0, 1) * M(2, 2);
+    adj(0, 2) = M(0, 1) * M(1, 2) - M(0, 2) * M(1, 1);
+    adj(1, 0) = M(1, 2) * M(2, 0) - M(1, 0) * M(2, 2);
+    adj(1, 1) = M(0, 0) * M(2, 2) - M(0, 2) * M(2, 0);
+    adj(1, 2) = M(0, 2) * M(1, 0) - M(0, 0) * M(1, 2);
+    adj(2, 0) = M(1, 0) * M(2, 1) - M(1, 1) * M(2, 0);
+    adj(2, 1) = M(0, 1) * M(2, 0) - M(0, 0) * M(2, 1);
+    adj(2, 2) = M(0, 0) * M(1, 1) - M(0, 1) * M(1, 0);
+    return adj;
+  }
+
   namespace normal_form_impl {
     /// \brief Return an elementary hermite transformation
     ///
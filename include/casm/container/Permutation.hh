@@ -3,6 +3,8 @@
 #ifndef PERMUTATION_HH
 #define PERMUTATION_HH
 
+#include <type_traits>
+
 #include "casm/container/Array.hh"
 
 namespace CASM {
@@ -96,6 +98,11 @@ namespace CASM {
     template<typename T>
     std::vector<T> permute(const std::vector<T> &before_array) const;
 
+    /// Write permuted copy of type-T vector into caller-owned 'after_array',
+    /// reusing its capacity; avoids the per-call allocation of permute()
+    template<typename T>
+    void permute_into(const std::vector<T> &before_array, std::vector<T> &after_array) const;
+
     /// Generate inversely permuted copy of type-T Array
     template<typename T>
     ReturnArray<T> ipermute(const Array<T> &before_array) const;
@@ -109,6 +116,25 @@ namespace CASM {
 
     jsonParser &to_json(jsonParser &json) const;
     void from_json(const jsonParser &json);
+
+  private:
+    /// Gather implementation for trivially copyable T: single allocation via
+    /// resize() and indexed assignment, which compilers can vectorize
+    template<typename T>
+    std::vector<T> _permute(const std::vector<T> &before_vec, std::true_type) const;
+
+    /// General implementation for types that may not be default-constructible
+    template<typename T>
+    std::vector<T> _permute(const std::vector<T> &before_vec, std::false_type) const;
+
+    /// Scatter implementation for default-constructible T: every slot of the
+    /// result is written exactly once, so the upfront deep copy is skipped
+    template<typename T>
+    ReturnArray<T> _ipermute(const Array<T> &before_array, std::true_type) const;
+
+    /// General implementation for types that may not be default-constructible
+    template<typename T>
+    ReturnArray<T> _ipermute(const Array<T> &before_array, std::false_type) const;
   };
 
   jsonParser &to_json(const Permutation &value, jsonParser &json);
@@ -135,6 +161,34 @@ namespace CASM {
     return after_array;
   }
 
+  //************************************************************************************************************************************//
+
+  /// Gather implementation for trivially copyable T. The permute loop is a pure
+  /// gather and memory-bound, so avoid push_back bookkeeping: one resize(), then
+  /// indexed assignment, which the compiler can auto-vectorize.
+  template<typename T>
+  std::vector<T> Permutation::_permute(const std::vector<T> &before_vec, std::true_type) const {
+    std::vector<T> after_vec(size());
+
+    const Index n = size();
+    for(Index i = 0; i < n; i++) {
+      after_vec[i] = before_vec[m_perm_array[i]];
+    }
+    return after_vec;
+  }
+
+  /// General implementation for types that may not be default-constructible
+  template<typename T>
+  std::vector<T> Permutation::_permute(const std::vector<T> &before_vec, std::false_type) const {
+    std::vector<T> after_vec;
+    after_vec.reserve(size());
+
+    for(Index i = 0; i < size(); i++) {
+      after_vec.push_back(before_vec[m_perm_array[i]]);
+    }
+    return after_vec;
+  }
+
 
   //************************************************************************************************************************************//
 
@@ -145,13 +199,24 @@ namespace CASM {
   std::vector<T> Permutation::permute(const std::vector<T> &before_vec) const {
     assert(before_vec.size() == size() && "WARNING: You're trying to permute an Array with an incompatible permutation!");
 
-    std::vector<T> after_vec;
-    after_vec.reserve(size());
+    return _permute(before_vec, typename std::is_trivially_copyable<T>::type());
+  }
 
-    for(Index i = 0; i < size(); i++) {
-      after_vec.push_back(before_vec[m_perm_array[i]]);
+  //************************************************************************************************************************************//
+
+  /// Write permuted copy of type-T std::vector into caller-owned 'after_vec'
+  /// Repeated callers (e.g. orbit generation) can reuse one scratch vector so
+  /// the permute loop does no allocation at steady state
+  template<typename T>
+  void Permutation::permute_into(const std::vector<T> &before_vec, std::vector<T> &after_vec) const {
+    assert(before_vec.size() == size() && "WARNING: You're trying to permute an Array with an incompatible permutation!");
+    assert(&before_vec != &after_vec && "WARNING: Permutation::permute_into cannot permute a vector into itself!");
+
+    after_vec.resize(size());
+    const Index n = size();
+    for(Index i = 0; i < n; i++) {
+      after_vec[i] = before_vec[m_perm_array[i]];
     }
-    return after_vec;
   }
 
   //**************************************************************
@@ -163,16 +228,33 @@ namespace CASM {
   ReturnArray<T> Permutation::ipermute(const Array<T> &before_array) const {
     assert(before_array.size() == size() && "WARNING: You're trying to permute an Array with an incompatible permutation!");
 
-    Array<T> after_array(before_array);
-    //after_array.reserve(size());
+    return _ipermute(before_array, typename std::is_default_constructible<T>::type());
+  }
 
-    for(Index i = 0; i < size(); i++) {
-      if(i != m_perm_array[i]) {
-        after_array[m_perm_array[i]] = before_array[i];
-      }
+  /// Scatter implementation for default-constructible T. Since m_perm_array
+  /// is a permutation, the scatter loop writes every slot of the result, so
+  /// copy-constructing after_array from before_array was pure waste.
+  template<typename T>
+  ReturnArray<T> Permutation::_ipermute(const Array<T> &before_array, std::true_type) const {
+    Array<T> after_array(size());
+
+    const Index n = size();
+    for(Index i = 0; i < n; i++) {
+      after_array[m_perm_array[i]] = before_array[i];
     }
     return after_array;
+  }
+
+  /// General implementation for types that may not be default-constructible
+  template<typename T>
+  ReturnArray<T> Permutation::_ipermute(const Array<T> &before_array, std::false_type) const {
+    Array<T> after_array(before_array);
 
+    const Index n = size();
+    for(Index i = 0; i < n; i++) {
+      after_array[m_perm_array[i]] = before_array[i];
+    }
+    return after_array;
   }
 
 }
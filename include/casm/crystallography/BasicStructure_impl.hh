@@ -327,6 +327,7 @@ namespace CASM {
     PrimGrid prim_grid(prim.lattice(), lattice());
 
     basis.clear();
+    basis.reserve(prim.basis.size() * prim_grid.size());
 
     //loop over basis sites of prim
     for(j = 0; j < prim.basis.size(); j++) {
@@ -336,15 +337,18 @@ namespace CASM {
 
         //push back translated basis site of prim onto superstructure basis
         basis.push_back(prim.basis[j] + prim_grid.coord(i, PRIM));
-
-        //reset lattice for most recent superstructure CoordType
-        //set_lattice() converts fractional coordinates to be compatible with new lattice
-        basis.back().set_lattice(lattice(), CART);
-
-        basis.back().within();
       }
     }
 
+    //reset lattice of each superstructure CoordType
+    //set_lattice() converts fractional coordinates to be compatible with new lattice
+    //each site is rebound and brought within independently of the others
+#pragma omp parallel for schedule(static)
+    for(Index n = 0; n < basis.size(); n++) {
+      basis[n].set_lattice(lattice(), CART);
+      basis[n].within();
+    }
+
     set_site_internals();
 
     return;
@@ -375,7 +375,9 @@ namespace CASM {
 
   /// \brief Returns a super Lattice
   inline Lattice make_supercell(const Lattice &lat, const Eigen::Matrix3i &transf_mat) {
-    return Lattice(Eigen::Matrix3d(lat.lat_column_mat()) * transf_mat.cast<double>());
+    //multiply straight from the cached column matrix; the explicit
+    //Matrix3d temporary forced an extra copy before the product
+    return Lattice(lat.lat_column_mat() * transf_mat.cast<double>());
   }
 
   /** @} */
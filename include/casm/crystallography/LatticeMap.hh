@@ -46,6 +46,9 @@ namespace CASM {
     static double calc_strain_cost(const Eigen::Matrix3d &F, double relaxed_atomic_vol);
   private:
     DMatType m_L1, m_L2;
+    //inverse of m_L1, computed once since the mapping loop applies it to
+    //every candidate 'N'
+    DMatType m_L1_inv;
     //Conversion matrices:
     //  m_N = m_U * m_inv_count().inverse() * m_V_inv
     DMatType m_U, m_V_inv;
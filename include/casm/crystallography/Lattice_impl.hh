@@ -1,3 +1,6 @@
+#include <array>
+#include <map>
+
 #include "casm/crystallography/Lattice.hh"
 #include "casm/crystallography/LatticeIsEquivalent.hh"
 #include "casm/symmetry/SymOp.hh"
@@ -16,29 +19,77 @@ namespace CASM {
     Eigen::Vector3i dim;
     dim = enclose_sphere(max_radius);
     EigenCounter<Eigen::Vector3i > grid_count(-dim, dim, Eigen::Vector3i(1));
-    double min_dist, dist;
+    double min_dist2, dist2;
     Array<CoordType> gridstruc;
     Eigen::Vector3i temp;
 
+    // compare squared distances so the inner loop avoids one sqrt per pair
+    const double min_r2(min_radius * min_radius);
+    const double max_r2(max_radius * max_radius);
+
+    // For large basis sets the O(basis^2) scan per grid point dominates.
+    // Bin basis sites into cubic cells of edge max_radius; any site within
+    // max_radius of a query then lies in one of the 27 neighboring cells.
+    typedef std::array<long, 3> CellKey;
+    std::map<CellKey, std::vector<Index> > cell_list;
+    const bool use_cell_list(basis.size() > 64 && max_radius > TOL);
+    if(use_cell_list) {
+      for(Index j = 0; j < basis.size(); j++) {
+        CellKey key;
+        for(int d = 0; d < 3; d++)
+          key[d] = (long)floor(basis[j].const_cart()[d] / max_radius);
+        cell_list[key].push_back(j);
+      }
+    }
+
+    // upper-bound capacity: every grid point could contribute a full basis
+    gridstruc.reserve((2 * dim[0] + 1) * (2 * dim[1] + 1) * (2 * dim[2] + 1) * basis.size());
+
     do {
       lat_point(FRAC) = grid_count();
 
       for(Index i = 0; i < basis.size(); i++) {
         CoordType tatom(basis[i] + lat_point);
-        //get distance to closest basis site in the unit cell at the origin
-
-        min_dist = 1e20;
-        for(Index j = 0; j < basis.size(); j++) {
-          dist = tatom.dist(basis[j]);
-          if(dist < min_dist)
-            min_dist = dist;
+        //get squared distance to closest basis site in the unit cell at the origin
+
+        min_dist2 = 1e20;
+        if(use_cell_list) {
+          // sites farther than max_radius from all cells in the neighborhood
+          // leave min_dist2 at 1e20 and are rejected below, as before
+          CellKey key, tkey;
+          for(int d = 0; d < 3; d++)
+            key[d] = (long)floor(tatom.const_cart()[d] / max_radius);
+          for(tkey[0] = key[0] - 1; tkey[0] <= key[0] + 1; tkey[0]++) {
+            for(tkey[1] = key[1] - 1; tkey[1] <= key[1] + 1; tkey[1]++) {
+              for(tkey[2] = key[2] - 1; tkey[2] <= key[2] + 1; tkey[2]++) {
+                auto it = cell_list.find(tkey);
+                if(it == cell_list.end())
+                  continue;
+                for(Index j : it->second) {
+                  dist2 = (tatom.const_cart() - basis[j].const_cart()).squaredNorm();
+                  if(dist2 < min_dist2)
+                    min_dist2 = dist2;
+                }
+              }
+            }
+          }
+        }
+        else {
+          for(Index j = 0; j < basis.size(); j++) {
+            dist2 = (tatom.const_cart() - basis[j].const_cart()).squaredNorm();
+            if(dist2 < min_dist2)
+              min_dist2 = dist2;
+            // once inside the exclusion radius the point is rejected no matter
+            // what the remaining basis sites contribute
+            if(min_dist2 < min_r2)
+              break;
+          }
         }
-        if(min_dist < min_radius) {
+        if(min_dist2 < min_r2) {
           continue;
         }
-        if(min_dist < max_radius) {
+        if(min_dist2 < max_r2) {
           gridstruc.push_back(tatom);
-          //          std::cout<<"tatom"<<tatom<<"\t Min Dist"<<min_dist<<"\n";
         }
       }
     }
@@ -25,7 +25,14 @@ namespace CASM {
 
   /// \brief A vacancy is any Specie/Molecule with (name == "VA" || name == "va" || name == "Va")
   inline bool is_vacancy(const std::string &name) {
-    return (name == "VA" || name == "va" || name == "Va");
+    // checked character-by-character so non-vacancy names (the common case in
+    // traversal loops) are rejected after at most two comparisons, instead of
+    // constructing/comparing up to three temporary strings
+    if(name.size() != 2)
+      return false;
+    if(name[0] == 'V')
+      return name[1] == 'A' || name[1] == 'a';
+    return name[0] == 'v' && name[1] == 'a';
   }
 
   class Specie {
@@ -131,6 +131,10 @@ namespace CASM {
     // map a UnitCellCoord inside the supercell
     UnitCellCoord get_within(const UnitCellCoord &_uccoord)const;
 
+    // map each UnitCellCoord of an array inside the supercell, in place;
+    // preferred over element-wise get_within when processing whole site lists
+    void get_within(Array<UnitCellCoord> &_uccoord_array)const;
+
     // get Coordinate or UnitCellCoord from linear index
     Coordinate coord(Index l, CELL_TYPE lat_mode)const;
     Coordinate coord(const UnitCellCoord &bijk, CELL_TYPE lat_mode)const;
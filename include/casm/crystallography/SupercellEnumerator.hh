@@ -66,15 +66,13 @@ namespace CASM {
 
       // add missing directions to 'dirs',
       // then permute 'G' so that the specified 'dirs' are first
-      while(m_dirs.size() != 3) {
-        if(std::find(m_dirs.begin(), m_dirs.end(), 'a') == m_dirs.end()) {
-          m_dirs.push_back('a');
-        }
-        if(std::find(m_dirs.begin(), m_dirs.end(), 'b') == m_dirs.end()) {
-          m_dirs.push_back('b');
-        }
-        if(std::find(m_dirs.begin(), m_dirs.end(), 'c') == m_dirs.end()) {
-          m_dirs.push_back('c');
+      bool specified[3] = {false, false, false};
+      for(int i = 0; i < m_dirs.size(); i++) {
+        specified[m_dirs[i] - 'a'] = true;
+      }
+      for(int i = 0; i < 3; i++) {
+        if(!specified[i]) {
+          m_dirs.push_back('a' + i);
         }
       }
       Eigen::Matrix3i P = Eigen::Matrix3i::Zero();
@@ -287,7 +285,7 @@ namespace CASM {
     pointer operator->() const;
 
     /// \brief constructed supercell matrix
-    Eigen::Matrix3i matrix() const;
+    const Eigen::Matrix3i &matrix() const;
 
     /// \brief current volume
     HermiteCounter::value_type volume() const;
@@ -320,6 +318,9 @@ namespace CASM {
     /// \brief Indicates if m_super reflects the current m_current supercell matrix
     mutable bool m_super_updated;
 
+    /// \brief Indicates if m_matrix reflects the current m_current supercell matrix
+    mutable bool m_matrix_updated;
+
     /// \brief Pointer to SupercellEnumerator which holds the unit cell and point group
     const SupercellEnumerator<UnitType> *m_enum;
 
@@ -329,6 +330,9 @@ namespace CASM {
     /// \brief A supercell, stored here so that iterator dereferencing will be OK. Only used when requested.
     mutable UnitType m_super;
 
+    /// \brief Canonical form of the current supercell matrix, computed once per counter state
+    mutable Eigen::Matrix3i m_matrix;
+
     /// \brief Keep track of the HNF matrices for the current determinant value
     std::vector<Eigen::Matrix3i> m_canon_hist;
 
@@ -357,7 +361,7 @@ namespace CASM {
     /// \param enum_props Data structure specifying how to enumerate supercells
     /// \param tol Tolerance for generating the point group
     ///
-    SupercellEnumerator(UnitType unit,
+    SupercellEnumerator(const UnitType &unit,
                         const ScelEnumProps &enum_props,
                         double tol);
 
@@ -369,7 +373,7 @@ namespace CASM {
     /// \param point_grp Point group operations to use for checking supercell uniqueness.
     /// \param enum_props Data structure specifying how to enumerate supercells
     ///
-    SupercellEnumerator(UnitType unit,
+    SupercellEnumerator(const UnitType &unit,
                         const SymGroup &point_grp,
                         const ScelEnumProps &enum_props);
 
@@ -475,15 +479,11 @@ namespace CASM {
                                                  int volume,
                                                  int dims):
     m_super_updated(false),
+    m_matrix_updated(false),
     m_enum(&enumerator),
     m_current(notstd::make_cloneable<HermiteCounter>(volume, dims)) {
-    if(enumerator.begin_volume() > enumerator.end_volume()) {
-      throw std::runtime_error("The beginning volume of the SupercellEnumerator cannot be greater than the end volume!");
-    }
-
-    if(dims < 1) {
-      throw std::runtime_error("Dimensions to count over must be greater than 0!");
-    }
+    //the volume range and dimension are validated once by the
+    //SupercellEnumerator constructor, not for every iterator it hands out
   }
 
   /*
@@ -499,6 +499,7 @@ namespace CASM {
     m_enum = B.m_enum;
     m_current = B.m_current;
     m_super_updated = false;
+    m_matrix_updated = false;
 
     m_canon_hist = B.m_canon_hist;
     return *this;
@@ -506,7 +507,9 @@ namespace CASM {
 
   template<typename UnitType>
   bool SupercellIterator<UnitType>::operator==(const SupercellIterator &B) const {
-    return (m_enum == B.m_enum) && (matrix() - B.matrix()).isZero();
+    //compare the integer determinants first; this settles the common
+    //loop-termination check against end() without canonicalizing either side
+    return (m_enum == B.m_enum) && (volume() == B.volume()) && (matrix() - B.matrix()).isZero();
   }
 
   template<typename UnitType>
@@ -538,9 +541,13 @@ namespace CASM {
   }
 
   template<typename UnitType>
-  Eigen::Matrix3i SupercellIterator<UnitType>::matrix() const {
-    Eigen::Matrix3i expanded = HermiteCounter_impl::_expand_dims((*m_current)(), m_enum->gen_mat());
-    return canonical_hnf(expanded, m_enum->point_group(), m_enum->lattice());
+  const Eigen::Matrix3i &SupercellIterator<UnitType>::matrix() const {
+    if(!m_matrix_updated) {
+      Eigen::Matrix3i expanded = HermiteCounter_impl::_expand_dims((*m_current)(), m_enum->gen_mat());
+      m_matrix = canonical_hnf(expanded, m_enum->point_group(), m_enum->lattice());
+      m_matrix_updated = true;
+    }
+    return m_matrix;
   }
 
   template<typename UnitType>
@@ -572,6 +579,7 @@ namespace CASM {
     m_canon_hist.push_back(matrix());
     HermiteCounter::value_type last_determinant = m_current->determinant();
     ++(*m_current);
+    m_matrix_updated = false;
 
     if(last_determinant != m_current->determinant()) {
       m_canon_hist.clear();
@@ -579,6 +587,7 @@ namespace CASM {
 
     while(std::find(m_canon_hist.begin(), m_canon_hist.end(), matrix()) != m_canon_hist.end()) {
       ++(*m_current);
+      m_matrix_updated = false;
     }
 
     m_super_updated = false;
@@ -666,12 +675,12 @@ namespace CASM {
   // declare specializations for Lattice
 
   template<>
-  SupercellEnumerator<Lattice>::SupercellEnumerator(Lattice unit,
+  SupercellEnumerator<Lattice>::SupercellEnumerator(const Lattice &unit,
                                                     const ScelEnumProps &enum_props,
                                                     double tol);
 
   template<>
-  SupercellEnumerator<Lattice>::SupercellEnumerator(Lattice unit,
+  SupercellEnumerator<Lattice>::SupercellEnumerator(const Lattice &unit,
                                                     const SymGroup &point_grp,
                                                     const ScelEnumProps &enum_props);
 
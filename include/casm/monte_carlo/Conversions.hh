@@ -2,7 +2,6 @@
 #define CASM_Monte_Conversions_HH
 
 #include <vector>
-#include <set>
 #include "casm/CASM_global_definitions.hh"
 
 namespace CASM {
@@ -46,8 +45,8 @@ namespace CASM {
       Index unitl_to_asym(Index unitl) const;
 
       Index asym_size() const;
-      const std::set<Index> &asym_to_b(Index asym) const;
-      const std::set<Index> &asym_to_unitl(Index asym) const;
+      const std::vector<Index> &asym_to_b(Index asym) const;
+      const std::vector<Index> &asym_to_unitl(Index asym) const;
 
       const Supercell &unit_scel() const;
       const Supercell &mc_scel() const;
@@ -72,8 +71,14 @@ namespace CASM {
 
       Index m_Nasym;
       std::vector<Index> m_unitl_to_asym;
-      std::vector<std::set<Index> > m_asym_to_unitl;
-      std::vector<std::set<Index> > m_asym_to_b;
+
+      /// m_l_to_unitl[l] -> unitl, tabulated once so that l_to_unitl/l_to_asym
+      /// are array lookups instead of a UnitCellCoord construction and
+      /// Supercell::find per call
+      std::vector<Index> m_l_to_unitl;
+      /// stored sorted & unique, so lookup/iteration run on contiguous storage
+      std::vector<std::vector<Index> > m_asym_to_unitl;
+      std::vector<std::vector<Index> > m_asym_to_b;
 
       /// m_occ_to_species[asym][occ_index] -> species_index
       std::vector<std::vector<Index> > m_occ_to_species;
@@ -13,8 +13,11 @@ namespace CASM {
     typedef unsigned long int size_type;
 
     /// \brief Default constructor
+    ///
+    /// Starts with room for 1024 observations, so a typical sampling run does
+    /// not climb through every power-of-two reallocation from a single slot
     MCData() :
-      MCData(1) {}
+      MCData(1024) {}
 
     /// \brief Constructor with initial buffer size 'count'
     MCData(size_type count) :
@@ -33,10 +36,13 @@ namespace CASM {
       ++m_size;
 
       // re-size as necessary by doubling reserved space
+      // swap with the grown buffer; assigning would copy the data a second
+      // time, and the tail past m_size is never read so it is left
+      // uninitialized
       if(m_size == m_observation.size()) {
-        Eigen::VectorXd tmp = Eigen::VectorXd::Zero(m_observation.size() * 2);
+        Eigen::VectorXd tmp(m_observation.size() * 2);
         tmp.head(m_observation.size()) = m_observation;
-        m_observation = tmp;
+        m_observation.swap(tmp);
       }
     }
 
@@ -112,7 +112,7 @@ namespace CASM {
     }
 
     /// \brief const Access a particular scalar property
-    const double &scalar_property(std::string property_name) const {
+    const double &scalar_property(const std::string &property_name) const {
       return m_scalar_property.find(property_name)->second;
     }
 
@@ -122,7 +122,7 @@ namespace CASM {
     }
 
     /// \brief const Access a particular vector property
-    const Eigen::VectorXd &vector_property(std::string property_name) const {
+    const Eigen::VectorXd &vector_property(const std::string &property_name) const {
       return m_vector_property.find(property_name)->second;
     }
 
@@ -219,7 +219,7 @@ namespace CASM {
     }
 
     /// \brief Access a particular scalar property
-    double &_scalar_property(std::string property_name) {
+    double &_scalar_property(const std::string &property_name) {
       return m_scalar_property.find(property_name)->second;
     }
 
@@ -229,7 +229,7 @@ namespace CASM {
     }
 
     /// \brief const Access a particular vector property
-    Eigen::VectorXd &_vector_property(std::string property_name) {
+    Eigen::VectorXd &_vector_property(const std::string &property_name) {
       return m_vector_property.find(property_name)->second;
     }
 
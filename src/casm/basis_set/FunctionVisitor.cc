@@ -5,80 +5,84 @@
 #include "casm/basis_set/PolynomialFunction.hh"
 #include "casm/basis_set/BasisSet.hh"
 #include "casm/misc/CASM_math.hh"
-namespace CASM {
 
+#include <cstring>
+
+namespace CASM {
 
-  OccFuncLabeler::OccFuncLabeler(const std::string &_template) {
-    // parse _template into the Array m_sub_strings
-    if(_template.size())
-      m_sub_strings.push_back(std::string());
-    for(Index i = 0; i < _template.size(); i++) {
-      if(_template[i] == '%') {
-        if(m_sub_strings.back().size())
-          m_sub_strings.push_back(std::string());
-        m_sub_strings.back() = _template.substr(i, 2);
-        if((++i) + 1 < _template.size())
-          m_sub_strings.push_back(std::string());
+  namespace {
+
+    /// Shared parse loop for the labeler template strings: literal runs
+    /// become single LITERAL tokens and each "%x" placeholder becomes a
+    /// tagged token. The next '%' is located with memchr, which scans a
+    /// cache line at a time, instead of branching per character.
+    std::vector<FormulaToken> parse_formula_template(const std::string &_template) {
+      std::vector<FormulaToken> tokens;
+      const char *p = _template.data();
+      const char *end = p + _template.size();
+      while(p != end) {
+        const char *q = static_cast<const char *>(memchr(p, '%', end - p));
+        if(q == nullptr) {
+          tokens.push_back(FormulaToken(FormulaToken::LITERAL, std::string(p, end)));
+          break;
+        }
+        if(q != p)
+          tokens.push_back(FormulaToken(FormulaToken::LITERAL, std::string(p, q)));
+        const char *tag_end = (end - q < 2) ? end : q + 2;
+        std::string tag(q, tag_end);
+        tokens.push_back(FormulaToken(FormulaToken::placeholder_kind(tag), tag));
+        p = tag_end;
       }
-      else
-        m_sub_strings.back().push_back(_template[i]);
+      return tokens;
     }
-    //std::cout << "substring expression: " << m_sub_strings << '\n';
+  }
+
+
+  OccFuncLabeler::OccFuncLabeler(const std::string &_template) :
+    m_tokens(parse_formula_template(_template)) {
   }
 
   //*******************************************************************************************
 
 
   bool OccFuncLabeler::visit(OccupantFunction &host, BasisSet const *bset_ptr)const {
-    m_ss.str(std::string());
-    m_ss.clear();
+    m_str.clear();
 
-    for(Index i = 0; i < m_sub_strings.size(); i++) {
-      if(m_sub_strings[i] == "%n") {
+    for(Index i = 0; i < m_tokens.size(); i++) {
+      switch(m_tokens[i].kind) {
+      case FormulaToken::NLIST_IND:
         if(valid_index(host.dof().ID()))
-          m_ss << host.dof().ID();
+          m_str += std::to_string(host.dof().ID());
         else
-          m_ss << '?';
-      }
-      else if(m_sub_strings[i] == "%f") {
+          m_str += '?';
+        break;
+      case FormulaToken::FUNC_IND:
         if(valid_index(host.occ_func_ind()))
-          m_ss << host.occ_func_ind();
+          m_str += std::to_string(host.occ_func_ind());
         else
-          m_ss << '?';
-      }
-      else if(m_sub_strings[i] == "%b") {
+          m_str += '?';
+        break;
+      case FormulaToken::BASIS_IND:
         if(valid_index(host.basis_ind()))
-          m_ss << host.basis_ind();
+          m_str += std::to_string(host.basis_ind());
         else
-          m_ss << '?';
+          m_str += '?';
+        break;
+      default:
+        m_str += m_tokens[i].text;
+        break;
       }
-      else
-        m_ss << m_sub_strings[i];
     }
     //std::cout << "Paying a visit. Formula before: " << host.formula() << "\n";
-    host.set_formula(m_ss.str());
+    host.set_formula(m_str);
     //std::cout << "                Formula after:  " << host.formula() << "\n";
     return true;
   }
 
   //*******************************************************************************************
 
-  VariableLabeler::VariableLabeler(const std::string &_template) {
-    // parse _template into the Array m_sub_strings
-    if(_template.size())
-      m_sub_strings.push_back(std::string());
-    for(Index i = 0; i < _template.size(); i++) {
-      if(_template[i] == '%') {
-        if(m_sub_strings.back().size())
-          m_sub_strings.push_back(std::string());
-        m_sub_strings.back() = _template.substr(i, 2);
-        if((++i) + 1 < _template.size())
-          m_sub_strings.push_back(std::string());
-      }
-      else
-        m_sub_strings.back().push_back(_template[i]);
-    }
-    //std::cout << "substring expression: " << m_sub_strings << '\n';
+  VariableLabeler::VariableLabeler(const std::string &_template) :
+    m_tokens(parse_formula_template(_template)) {
   }
 
   //*******************************************************************************************
@@ -89,8 +93,14 @@ namespace CASM {
     std::stringstream tformula, ttex;
     Array<int> var_ind;
 
-    for(Index i = 0; i < host.var_compon().size(); i++) {
-      if(!almost_zero(host.coeffs()[i])) {
+    //invariants of the loops below: the coefficient vector, the DoF list,
+    //and the denominator bound passed to irrational_to_tex_string
+    const Eigen::VectorXd &coeffs(host.coeffs());
+    const Array<ContinuousDoF> &var_compon_list(host.var_compon());
+    const int max_denom(10 * coeffs.size() * coeffs.size());
+
+    for(Index i = 0; i < var_compon_list.size(); i++) {
+      if(!almost_zero(coeffs[i])) {
         var_ind.push_back(i);
       }
     }
@@ -101,12 +111,12 @@ namespace CASM {
       return false;
     }
 
-    double var_scale(host.coeffs()[var_ind[0]]);
+    double var_scale(coeffs[var_ind[0]]);
     if(almost_zero(var_scale + 1)) {
       ttex << '-';
     }
     else if(!almost_zero(var_scale - 1)) {
-      ttex << irrational_to_tex_string(var_scale, 10 * host.coeffs().size() * host.coeffs().size());
+      ttex << irrational_to_tex_string(var_scale, max_denom);
     }
 
     if(var_ind.size() > 1) {
@@ -114,10 +124,14 @@ namespace CASM {
       ttex << "(";
     }
 
+    //var_scale can't be almost_zero, so divide by it once rather than per term
+    const double inv_var_scale(1.0 / var_scale);
+
     double coeff;
     for(Index i = 0; i < var_ind.size(); i++) {
-      const ContinuousDoF &var_compon(host.var_compon()[var_ind[i]]);
-      coeff = host.coeffs()[var_ind[i]];
+      const ContinuousDoF &var_compon(var_compon_list[var_ind[i]]);
+      coeff = coeffs[var_ind[i]];
+      const double scaled_coeff(coeff * inv_var_scale);
 
       if(i > 0 && coeff > 0) {
         tformula << '+';
@@ -130,18 +144,19 @@ namespace CASM {
         tformula << '*';
       }
 
-      if(i > 0 && coeff / var_scale > 0) {
+      if(i > 0 && scaled_coeff > 0) {
         ttex << '+';
       }
-      if(almost_zero(coeff / var_scale + 1)) {
+      if(almost_zero(scaled_coeff + 1)) {
         ttex << '-';
       }
-      if(!almost_zero(std::abs(coeff / var_scale) - 1)) {
-        ttex << irrational_to_tex_string(coeff / var_scale, 10 * host.coeffs().size() * host.coeffs().size()) << ' ';
+      if(!almost_zero(std::abs(scaled_coeff) - 1)) {
+        ttex << irrational_to_tex_string(scaled_coeff, max_denom) << ' ';
       }
 
-      for(Index j = 0; j < m_sub_strings.size(); j++) {
-        if(m_sub_strings[j] == "%n") {
+      for(Index j = 0; j < m_tokens.size(); j++) {
+        switch(m_tokens[j].kind) {
+        case FormulaToken::NLIST_IND:
           if(valid_index(var_compon.ID())) {
             ttex << var_compon.ID();
             tformula << var_compon.ID();
@@ -151,24 +166,27 @@ namespace CASM {
             ttex << '?';
             tformula << '?';
           }
-        }
-        else if(m_sub_strings[j] == "%p") {
+          break;
+        case FormulaToken::TYPE_PREFIX: {
           std::string prefix = var_compon.type_name_prefix();
           if(prefix.empty())
             prefix = "?";
           ttex << prefix;
           tformula << prefix;
+          break;
         }
-        else if(m_sub_strings[j] == "%s") {
+        case FormulaToken::TYPE_SUFFIX: {
           std::string suffix = var_compon.type_name_suffix();
           if(suffix.empty())
             suffix = "?";
           ttex << suffix;
           tformula << suffix;
+          break;
         }
-        else {
-          ttex << m_sub_strings[j];
-          tformula << m_sub_strings[j];
+        default:
+          ttex << m_tokens[j].text;
+          tformula << m_tokens[j].text;
+          break;
         }
       }
     }
@@ -189,22 +207,8 @@ namespace CASM {
   }
 
   //*******************************************************************************************
-  SubExpressionLabeler::SubExpressionLabeler(const std::string &_bset_name, const std::string &_template) : m_bset_name(_bset_name) {
-    // parse _template into the Array m_sub_strings
-    if(_template.size())
-      m_sub_strings.push_back(std::string());
-    for(Index i = 0; i < _template.size(); i++) {
-      if(_template[i] == '%') {
-        if(m_sub_strings.back().size())
-          m_sub_strings.push_back(std::string());
-        m_sub_strings.back() = _template.substr(i, 2);
-        if((++i) + 1 < _template.size())
-          m_sub_strings.push_back(std::string());
-      }
-      else
-        m_sub_strings.back().push_back(_template[i]);
-    }
-    //std::cout << "substring expression: " << m_sub_strings << " and bset_name is " << m_bset_name << '\n';
+  SubExpressionLabeler::SubExpressionLabeler(const std::string &_bset_name, const std::string &_template) :
+    m_bset_name(_bset_name), m_tokens(parse_formula_template(_template)) {
   }
 
   //*******************************************************************************************
@@ -234,34 +238,37 @@ namespace CASM {
       return false;
     }
 
-    m_ss.str(std::string());
-    m_ss.clear();
+    m_str.clear();
 
-    for(Index i = 0; i < m_sub_strings.size(); i++) {
-      if(m_sub_strings[i] == "%n") {
+    for(Index i = 0; i < m_tokens.size(); i++) {
+      switch(m_tokens[i].kind) {
+      case FormulaToken::NLIST_IND:
         if(bset_ptr->dof_IDs().size() == 0) {
-          m_ss << '?';
+          m_str += '?';
         }
         else {
-          for(Index i = 0; i < bset_ptr->dof_IDs().size(); i++) {
-            m_ss << (bset_ptr->dof_IDs())[i];
-            if(i + 1 < bset_ptr->dof_IDs().size())
-              m_ss << '_';
+          for(Index j = 0; j < bset_ptr->dof_IDs().size(); j++) {
+            m_str += std::to_string((bset_ptr->dof_IDs())[j]);
+            if(j + 1 < bset_ptr->dof_IDs().size())
+              m_str += '_';
           }
         }
-      }
-      else if(m_sub_strings[i] == "%f") {
+        break;
+      case FormulaToken::FUNC_IND: {
         Index f = bset_ptr->find(&host);
         if(f < bset_ptr->size())
-          m_ss << f;
+          m_str += std::to_string(f);
         else
-          m_ss << '?';
+          m_str += '?';
+        break;
+      }
+      default:
+        m_str += m_tokens[i].text;
+        break;
       }
-      else
-        m_ss << m_sub_strings[i];
     }
     //std::cout << "Paying a visit. Formula before: " << host.formula() << "\n";
-    host.set_formula(m_ss.str());
+    host.set_formula(m_str);
     //std::cout << "                Formula after:  " << host.formula() << "\n";
     return true;
 
@@ -107,10 +107,11 @@ namespace CASM {
     json["species_order"] = ref.prim().get_struc_molecule_name();
 
     if(ref.global_ref_states().empty()) {
-      to_json(ref.global().transpose(), json["global"]);
-      json["global"].put_array();
-      for(int i = 0; i < ref.global().size(); ++i) {
-        json["global"].push_back(ref.global()(i));
+      const Eigen::VectorXd &global = ref.global();
+      jsonParser &g_json = json["global"];
+      g_json.put_array();
+      for(int i = 0; i < global.size(); ++i) {
+        g_json.push_back(global(i));
       }
     }
     else {
@@ -277,11 +277,15 @@ namespace CASM {
   /// \brief Returns num_each_molecule[ molecule_type], where 'molecule_type' is ordered as Structure::get_struc_molecule()
   ReturnArray<int> get_num_each_molecule(const ConfigDoF &configdof, const Supercell &scel) {
 
+    // derive the molecule list once; it is rebuilt from scratch by every
+    // get_struc_molecule() call
+    auto struc_molecule = scel.get_prim().get_struc_molecule();
+
     // [basis_site][site_occupant_index]
-    auto convert = get_index_converter(scel.get_prim(), scel.get_prim().get_struc_molecule());
+    auto convert = get_index_converter(scel.get_prim(), struc_molecule);
 
     // create an array to count the number of each molecule
-    Array<int> num_each_molecule(scel.get_prim().get_struc_molecule().size(), 0);
+    Array<int> num_each_molecule(struc_molecule.size(), 0);
 
     // count the number of each molecule
     for(Index i = 0; i < configdof.size(); i++) {
@@ -294,11 +298,15 @@ namespace CASM {
   /// \brief Returns num_each_molecule(molecule_type), where 'molecule_type' is ordered as Structure::get_struc_molecule()
   Eigen::VectorXi get_num_each_molecule_vec(const ConfigDoF &configdof, const Supercell &scel) {
 
+    // derive the molecule list once; it is rebuilt from scratch by every
+    // get_struc_molecule() call
+    auto struc_molecule = scel.get_prim().get_struc_molecule();
+
     // [basis_site][site_occupant_index]
-    auto convert = get_index_converter(scel.get_prim(), scel.get_prim().get_struc_molecule());
+    auto convert = get_index_converter(scel.get_prim(), struc_molecule);
 
     // create an array to count the number of each molecule
-    Eigen::VectorXi num_each_molecule = Eigen::VectorXi::Zero(scel.get_prim().get_struc_molecule().size());
+    Eigen::VectorXi num_each_molecule = Eigen::VectorXi::Zero(struc_molecule.size());
 
     // count the number of each molecule
     for(Index i = 0; i < configdof.size(); i++) {
@@ -64,13 +64,13 @@ namespace CASM {
       double wedgevol = sqrt((wedges[s].transpose() * wedges[s]).determinant());
       Index N = round(pow(linear_partitions[s], wedges[s].cols()));
       //double density = double(N) / pow(magnitudes[s], wedges[s].cols());
-      std::cout << "wedgevol: " << wedgevol << ", N: " << N;// << ", density: " << density;
+      //std::cout << "wedgevol: " << wedgevol << ", N: " << N;// << ", density: " << density;
       N = max(1, (int) ceil(pow(wedgevol * double(N), 1.0 / double(wedges[s].cols())) - TOL));
-      std::cout << ", linearN: " << N << "\n";
-      std::cout << "mult.size() is: " << mult.size() << "  and mult is ";
-      for(auto m : mult)
-        std::cout  << m << "  ";
-      std::cout << "\n";
+      //std::cout << ", linearN: " << N << "\n";
+      //std::cout << "mult.size() is: " << mult.size() << "  and mult is ";
+      //for(auto m : mult)
+      //std::cout  << m << "  ";
+      //std::cout << "\n";
 
       for(Index i = 0; i < wedges[s].cols(); i++, nc++) {
         if(mult[nc] == 1 && linear_partitions[s] > 1) {
@@ -149,13 +149,14 @@ namespace CASM {
 
     m_counter = EigenCounter<Eigen::VectorXd>(init, final, inc);
 
-    std::cout << "Project matrices are \n";
-    for(Index i = 0; i < m_trans_mats.size(); i++)
-      std::cout << i << " of " << m_trans_mats.size() << "\n" << m_trans_mats[i] << "\n\n";
+    //std::cout << "Project matrices are \n";
+    //for(Index i = 0; i < m_trans_mats.size(); i++)
+    //std::cout << i << " of " << m_trans_mats.size() << "\n" << m_trans_mats[i] << "\n\n";
     m_shape_factor = m_strain_calc.sop_transf_mat().transpose() * m_shape_factor * m_strain_calc.sop_transf_mat();
+    _set_equiv_shape_factor();
 
     m_counter.reset();
-    while(m_counter.valid() && double(m_counter().transpose()*m_trans_mats[m_equiv_ind].transpose()*m_shape_factor * m_trans_mats[m_equiv_ind]*m_counter()) > 1.0 + TOL) {
+    while(m_counter.valid() && double(m_counter().transpose()*m_equiv_shape_factor * m_counter()) > 1.0 + TOL) {
       ++m_counter;
     }
 
@@ -173,7 +174,7 @@ namespace CASM {
     //bool is_valid_config(false);
     //std::cout << "Incrementing...\n";
 
-    while(++m_counter && double(m_counter().transpose()*m_trans_mats[m_equiv_ind].transpose()*m_shape_factor * m_trans_mats[m_equiv_ind]*m_counter()) > 1.0 + TOL) {
+    while(++m_counter && double(m_counter().transpose()*m_equiv_shape_factor * m_counter()) > 1.0 + TOL) {
       //just burning throught the count
     }
 
@@ -181,17 +182,18 @@ namespace CASM {
     if(!m_counter.valid() && m_equiv_ind + 1 < m_trans_mats.size()) {
       m_counter.reset();
       ++m_equiv_ind;
-      std::cout << "INCREMENTING m_equiv_ind to " << m_equiv_ind << "\n";
+      _set_equiv_shape_factor();
+      //std::cout << "INCREMENTING m_equiv_ind to " << m_equiv_ind << "\n";
     }
 
-    while(m_counter && double(m_counter().transpose()*m_trans_mats[m_equiv_ind].transpose()*m_shape_factor * m_trans_mats[m_equiv_ind]*m_counter()) > 1.0 + TOL) {
+    while(m_counter && double(m_counter().transpose()*m_equiv_shape_factor * m_counter()) > 1.0 + TOL) {
       //just burning throught the count
       ++m_counter;
     }
 
     if(m_counter.valid()) {
       _current().set_deformation(m_strain_calc.unrolled_strain_metric_to_F(m_trans_mats[m_equiv_ind] * m_counter()));
-      std::cout << "Counter is " << m_counter().transpose() << "\n\n";
+      //std::cout << "Counter is " << m_counter().transpose() << "\n\n";
       //std::cout << "strain vector is \n" << m_trans_mats[m_equiv_ind]*m_counter() << "\n\n";
       //std::cout << "DEFORMATION IS\n" << _current().deformation() << "\n\n";
       //is_valid_config = current().is_canonical(_perm_begin(), _perm_end());
@@ -748,16 +748,19 @@ namespace CASM {
     if(it != m_superlat_map.end())
       return it->second;
 
+    //invariants of the collection loop below
+    const SymGroup &pg = primclex().get_prim().point_group();
+
     std::vector<Lattice> lat_vec;
     SupercellEnumerator<Lattice> enumerator(
       primclex().get_prim().lattice(),
-      primclex().get_prim().point_group(),
+      pg,
       ScelEnumProps(prim_vol, prim_vol + 1));
 
     //std::cout << "min_vol is " << min_vol << "max_vol is " << max_vol << "\n";
     for(auto it = enumerator.begin(); it != enumerator.end(); ++it) {
       //std::cout << "Enumeration step " << l++ << " best cost is " << best_cost << "\n";
-      lat_vec.push_back(canonical_equivalent_lattice(*it, primclex().get_prim().point_group(), m_tol));
+      lat_vec.push_back(canonical_equivalent_lattice(*it, pg, m_tol));
     }
 
     return m_superlat_map[prim_vol] = std::move(lat_vec);
@@ -791,19 +794,42 @@ namespace CASM {
       //if(cost_matrix.rows()!=scel.num_sites() || cost_matrix.cols()!=scel.num_sites())
       cost_matrix = Eigen::MatrixXd::Constant(scel.num_sites(), scel.num_sites(), inf);
       Index inf_counter;
+
+      // Supercell site coordinates don't depend on the relaxed site, so build
+      // them once instead of once per (i,j) pair
+      std::vector<Coordinate> scel_coord;
+      scel_coord.reserve(scel.num_sites());
+      for(Index i = 0; i < scel.num_sites(); i++)
+        scel_coord.push_back(scel.coord(i));
+
+      // Whether species are allowed on site i depends only on its sublattice,
+      // so resolve each occupant-list lookup once per (sublattice, species)
+      const Array<Site> &prim_basis = scel.get_prim().basis;
+
+      // Each relaxed site fills an independent column of the cost matrix, so
+      // the columns are distributed across threads; the unassignable-atom
+      // bail-out is deferred to a shared flag checked after the loop
+      bool infeasible = false;
+
       // loop through all the sites of the structure
-      Index j = 0;
-      for(; j < rstruc.basis.size(); j++) {
+      #pragma omp parallel for schedule(static)
+      for(Index j = 0; j < rstruc.basis.size(); j++) {
         Coordinate current_relaxed_coord(rstruc.basis[j].frac(), scel.get_real_super_lattice(), FRAC);
         current_relaxed_coord.cart() += trans.cart();
+
+        std::string species = rstruc.basis[j].occ_name();
+        std::vector<bool> species_allowed(prim_basis.size());
+        for(Index b = 0; b < prim_basis.size(); b++)
+          species_allowed[b] = prim_basis[b].contains(species);
+
         // loop through all the sites in the supercell
-        inf_counter = 0;
+        Index inf_counter = 0;
         for(Index i = 0; i < scel.num_sites(); i++) {
 
           // Check if relaxed atom j is allowed on site i
           // If so, populate cost_matrix normally
-          if(scel.get_prim().basis[scel.get_b(i)].contains(rstruc.basis[j].occ_name())) {
-            cost_matrix(i, j) = scel.coord(i).min_dist2(current_relaxed_coord, metric);
+          if(species_allowed[scel.get_b(i)]) {
+            cost_matrix(i, j) = scel_coord[i].min_dist2(current_relaxed_coord, metric);
           }
           // If not, set cost_matrix (i,j) = inf
           else {
@@ -813,17 +839,24 @@ namespace CASM {
         }
         if(inf_counter == scel.num_sites()) {
           //std:: cerr << "Bail at 1\n";
-          return false;
+          #pragma omp atomic write
+          infeasible = true;
         }
       }
+      if(infeasible) {
+        return false;
+      }
 
+      std::vector<bool> va_allowed(prim_basis.size());
+      for(Index b = 0; b < prim_basis.size(); b++)
+        va_allowed[b] = prim_basis[b].contains("Va");
 
-      for(; j < scel.num_sites(); j++) {
+      for(Index j = rstruc.basis.size(); j < scel.num_sites(); j++) {
         inf_counter = 0;
         for(Index i = 0; i < scel.num_sites(); i++) {
 
           // Check if vacancies are allowed at each position in the supercell
-          if(scel.get_prim().basis[scel.get_b(i)].contains("Va")) {
+          if(va_allowed[scel.get_b(i)]) {
             cost_matrix(i, j) = 0;
           }
           else {
@@ -857,19 +890,52 @@ namespace CASM {
       //if(cost_matrix.rows()!=scel.num_sites() || cost_matrix.cols()!=scel.num_sites())
       cost_matrix = Eigen::MatrixXd::Constant(scel.num_sites(), scel.num_sites(), inf);
       Index inf_counter;
+
+      // Site coordinates and occupant names don't depend on the relaxed site,
+      // so resolve them once instead of once per (i,j) pair. Occupant names
+      // are interned into a small table so the inner loops compare integer
+      // ids rather than strings
+      std::vector<Coordinate> scel_coord;
+      std::vector<std::string> name_table;
+      std::vector<Index> mol_name_id;
+      scel_coord.reserve(scel.num_sites());
+      mol_name_id.reserve(scel.num_sites());
+      for(Index i = 0; i < scel.num_sites(); i++) {
+        scel_coord.push_back(scel.coord(i));
+        const std::string &name = config.get_mol(i).name;
+        Index id = 0;
+        while(id < name_table.size() && name_table[id] != name)
+          id++;
+        if(id == name_table.size())
+          name_table.push_back(name);
+        mol_name_id.push_back(id);
+      }
+      Index va_id = 0;
+      while(va_id < name_table.size() && name_table[va_id] != "Va")
+        va_id++;
+
+      // Columns are independent (see the Supercell overload above)
+      bool infeasible = false;
+
       // loop through all the sites of the structure
-      Index j;
-      for(j = 0; j < rstruc.basis.size(); j++) {
+      #pragma omp parallel for schedule(static)
+      for(Index j = 0; j < rstruc.basis.size(); j++) {
         Coordinate current_relaxed_coord(rstruc.basis[j].frac(), scel.get_real_super_lattice(), FRAC);
         current_relaxed_coord.cart() += trans.cart();
+
+        std::string species = rstruc.basis[j].occ_name();
+        Index species_id = 0;
+        while(species_id < name_table.size() && name_table[species_id] != species)
+          species_id++;
+
         // loop through all the sites in the supercell
-        inf_counter = 0;
+        Index inf_counter = 0;
         for(Index i = 0; i < scel.num_sites(); i++) {
 
           // Check if relaxed atom j is allowed on site i
           // If so, populate cost_matrix normally
-          if(config.get_mol(i).name == rstruc.basis[j].occ_name()) {
-            cost_matrix(i, j) = scel.coord(i).min_dist2(current_relaxed_coord, metric);
+          if(mol_name_id[i] == species_id) {
+            cost_matrix(i, j) = scel_coord[i].min_dist2(current_relaxed_coord, metric);
           }
           // If not, set cost_matrix (i,j) = inf
           else {
@@ -879,17 +945,21 @@ namespace CASM {
         }
         if(inf_counter == scel.num_sites()) {
           //std:: cerr << "Bail at 1\n";
-          return false;
+          #pragma omp atomic write
+          infeasible = true;
         }
       }
+      if(infeasible) {
+        return false;
+      }
 
 
-      for(; j < scel.num_sites(); j++) {
+      for(Index j = rstruc.basis.size(); j < scel.num_sites(); j++) {
         inf_counter = 0;
         for(Index i = 0; i < scel.num_sites(); i++) {
 
           // Check if vacancies are allowed at each position in the supercell
-          if(config.get_mol(i).name == "Va") {
+          if(mol_name_id[i] == va_id) {
             cost_matrix(i, j) = 0;
           }
           else {
@@ -197,9 +197,17 @@ namespace CASM {
 
     UnitCellCoord bijk;
 
+    // every unitcell has the same number of neighbors, so the final row sizes
+    // are known up front
+    size_type n_unitcell = prim_nlist.size();
+    size_type n_site = n_unitcell * prim_nlist.sublat_indices().size();
+
     // for each unit cell in the supercell
     for(Index i = 0; i < m_prim_grid_size; ++i) {
 
+      m_unitcell[i].reserve(n_unitcell);
+      m_site[i].reserve(n_site);
+
       // for each neighbor unitcell
       for(auto it = prim_nlist.begin(); it != prim_nlist.end(); ++it) {
 
@@ -1526,8 +1526,12 @@ namespace CASM {
 
     // Write neighborhood of UnitCellCoord
     // expand the nlist to contain 'global_orbitree' (all that is needed for now)
-    std::set<UnitCellCoord> nbors;
-    neighborhood(std::inserter(nbors, nbors.begin()), tree, prim, TOL);
+    // collect into a vector and sort/unique once; building a red-black tree
+    // node per UnitCellCoord is slower for the one-shot sorted traversal below
+    std::vector<UnitCellCoord> nbors;
+    neighborhood(std::back_inserter(nbors), tree, prim, TOL);
+    std::sort(nbors.begin(), nbors.end());
+    nbors.erase(std::unique(nbors.begin(), nbors.end()), nbors.end());
 
     /*
     for(auto it = nbors.begin(); it != nbors.end(); ++it) {
@@ -1560,8 +1564,10 @@ namespace CASM {
     Index lno = 0;
     for(Index nb = 0; nb < tree.size(); ++nb) {
       for(Index no = 0; no < tree[nb].size(); ++no) {
-        std::set<UnitCellCoord> orbit_nbors;
-        orbit_neighborhood(std::inserter(orbit_nbors, orbit_nbors.begin()), tree, prim, nb, no, TOL);
+        std::vector<UnitCellCoord> orbit_nbors;
+        orbit_neighborhood(std::back_inserter(orbit_nbors), tree, prim, nb, no, TOL);
+        std::sort(orbit_nbors.begin(), orbit_nbors.end());
+        orbit_nbors.erase(std::unique(orbit_nbors.begin(), orbit_nbors.end()), orbit_nbors.end());
 
         Index proto_index = lno;
         /*
@@ -892,17 +892,19 @@ namespace CASM {
   //***********************************************************
 
   SymOp Supercell::to_canonical() const {
-    return get_real_super_lattice().to_canonical(
-             get_prim().point_group(),
-             get_primclex().crystallography_tol());
+    if(!m_to_canonical) {
+      m_to_canonical = notstd::make_cloneable<SymOp>(
+                         get_real_super_lattice().to_canonical(
+                           get_prim().point_group(),
+                           get_primclex().crystallography_tol()));
+    }
+    return *m_to_canonical;
   }
 
   //***********************************************************
 
   SymOp Supercell::from_canonical() const {
-    return get_real_super_lattice().from_canonical(
-             get_prim().point_group(),
-             get_primclex().crystallography_tol());
+    return to_canonical().inverse();
   }
 
   //***********************************************************
@@ -933,12 +935,13 @@ namespace CASM {
    */
   //***********************************************************
   bool Supercell::is_supercell_of(const Structure &structure, Eigen::Matrix3d &mat) const {
-    Structure tstruct = structure;
+    //only the lattice point group is needed, so generate it directly rather
+    //than deep-copying the entire Structure first
     SymGroup point_group;
-    tstruct.lattice().generate_point_group(point_group);
-    //if(real_super_lattice.is_supercell_of(tstruct.lattice, tstruct.factor_group().point_group(), mat)) {
+    structure.lattice().generate_point_group(point_group);
+    //if(real_super_lattice.is_supercell_of(structure.lattice, structure.factor_group().point_group(), mat)) {
 
-    if(real_super_lattice.is_supercell_of(tstruct.lattice(), point_group, mat)) {
+    if(real_super_lattice.is_supercell_of(structure.lattice(), point_group, mat)) {
 
       return true;
     }
@@ -1120,13 +1123,27 @@ namespace CASM {
   **/
   //**********************************************************
   Eigen::MatrixXd Supercell::real_coordinates() const {
-    Eigen::MatrixXd real_coords(volume(), 3);
+    // batched version of the per-point Coordinate conversion: gather the
+    // integer unit cells once, then do the PRIM->cart and cart->SCEL-frac
+    // conversions as single 3xN products instead of N 3x3 matvecs
+    Eigen::MatrixXd unit_cells(3, volume());
     for(int i = 0; i < volume(); i++) {
-      Coordinate temp_real_point = m_prim_grid.coord(i, SCEL);
-      temp_real_point.within(); //should this also be voronoi within?
-      real_coords.row(i) = temp_real_point.const_cart().transpose();
+      unit_cells.col(i) = m_prim_grid.uccoord(i).unitcell().cast<double>();
     }
-    return real_coords;
+
+    Eigen::MatrixXd frac_coords =
+      real_super_lattice.inv_lat_column_mat() *
+      ((*primclex).get_prim().lattice().lat_column_mat() * unit_cells);
+
+    // same wrap as Coordinate::within(), applied to the whole block
+    //(should this also be voronoi within?)
+    for(int j = 0; j < frac_coords.cols(); j++) {
+      for(int r = 0; r < 3; r++) {
+        frac_coords(r, j) -= floor(frac_coords(r, j) + 1E-6);
+      }
+    }
+
+    return (real_super_lattice.lat_column_mat() * frac_coords).transpose();
   }
 
   //**********************************************************
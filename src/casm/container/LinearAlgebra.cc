@@ -66,7 +66,21 @@ namespace CASM {
         "  M must be square.");
     }
 
-    if(boost::math::iround(M.cast<double>().determinant()) == 0) {
+    // Full rank check. For the common 3x3 case, compute the determinant
+    // exactly in integer arithmetic via cofactor expansion, rather than
+    // round-tripping through the floating-point determinant.
+    bool singular;
+    if(M.rows() == 3) {
+      long det = long(M(0, 0)) * (long(M(1, 1)) * M(2, 2) - long(M(1, 2)) * M(2, 1))
+                 - long(M(0, 1)) * (long(M(1, 0)) * M(2, 2) - long(M(1, 2)) * M(2, 0))
+                 + long(M(0, 2)) * (long(M(1, 0)) * M(2, 1) - long(M(1, 1)) * M(2, 0));
+      singular = (det == 0);
+    }
+    else {
+      singular = (boost::math::iround(M.cast<double>().determinant()) == 0);
+    }
+
+    if(singular) {
       throw std::runtime_error(
         std::string("Error in hermite_normal_form(const Eigen::MatrixXi &M)\n") +
         "  M must be full rank.");
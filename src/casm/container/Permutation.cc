@@ -117,9 +117,19 @@ namespace CASM {
   /// Does not (nearly certain of this) depend on permutation convention
   Permutation Permutation::transformed_by(const Permutation &trans_perm) const {
 
-    // Equivalent to Permutation(trans_perm*(*this)*trans_perm.inverse());
-    // There's probably a faster element-wise implementation, but it would be confusing
-    return Permutation(ReturnArray<Index>(trans_perm.permute(permute(trans_perm.inverse().m_perm_array))));
+    // Equivalent to Permutation(trans_perm*(*this)*trans_perm.inverse()),
+    // computed element-wise as result[i] = inv_trans[(*this)[trans_perm[i]]]
+    // so that only the inverse and the result are materialized
+    Array<Index> inv_trans(size(), 0);
+    for(Index i = 0; i < size(); i++) {
+      inv_trans[trans_perm.m_perm_array[i]] = i;
+    }
+
+    Array<Index> result(size(), 0);
+    for(Index i = 0; i < size(); i++) {
+      result[i] = inv_trans[m_perm_array[trans_perm.m_perm_array[i]]];
+    }
+    return Permutation(ReturnArray<Index>(result));
   }
 
   //**************************************************************
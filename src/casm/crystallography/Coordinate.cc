@@ -206,7 +206,10 @@ namespace CASM {
     vector_type tfrac(frac() - neighbor.frac());
     tfrac -= lround(tfrac).cast<double>();
 
-    return (home().lat_column_mat() * tfrac).dot(metric * (home().lat_column_mat() * tfrac));
+    // evaluate the cartesian displacement once; the expression template would
+    // otherwise redo the lat_column_mat product on both sides of the dot
+    vector_type tcart(home().lat_column_mat() * tfrac);
+    return tcart.dot(metric * tcart);
   }
 
   //********************************************************************
@@ -1214,23 +1214,33 @@ namespace CASM {
   Lattice replace_vector(const Lattice &lat, const Eigen::Vector3d &new_vector, double tol) {
 
     // replace a lattice vector with translation
-    Lattice new_lat {lat};
-    double min_vol = std::abs(volume(new_lat));
+    double min_vol = std::abs(volume(lat));
+    int best_axis = -1;
 
+    //test each replacement on a plain matrix workspace; constructing a
+    //Lattice per axis would also rebuild the cached inverse three times
+    //just to take a determinant
+    Eigen::Matrix3d tmp_lat_mat;
     for(int i = 0; i < 3; i++) {
 
-      Lattice tmp_lat = lat;
-      tmp_lat[i] = new_vector;
-      double vol = std::abs(volume(tmp_lat));
+      tmp_lat_mat = lat.lat_column_mat();
+      tmp_lat_mat.col(i) = new_vector;
+      double vol = std::abs(tmp_lat_mat.determinant());
 
       if(vol < min_vol && vol > tol) {
         min_vol = vol;
-        new_lat = tmp_lat;
+        best_axis = i;
       }
 
     }
 
-    return new_lat;
+    if(best_axis < 0) {
+      return lat;
+    }
+
+    tmp_lat_mat = lat.lat_column_mat();
+    tmp_lat_mat.col(best_axis) = new_vector;
+    return Lattice(tmp_lat_mat);
   }
 
 }
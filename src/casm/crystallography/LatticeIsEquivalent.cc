@@ -10,7 +10,7 @@ namespace CASM {
 
   /// Is this lattice the same, even if they have different lattice vectors
   bool LatticeIsEquivalent::operator()(const Lattice &B) const {
-    Eigen::Matrix3d T = lat_column_mat().inverse() * B.lat_column_mat();
+    Eigen::Matrix3d T = inv_lat_column_mat() * B.lat_column_mat();
     return is_unimodular(T, m_tol);
   }
 
@@ -23,7 +23,7 @@ namespace CASM {
   bool LatticeIsEquivalent::operator()(const Eigen::Matrix3d &cart_op) const {
     Eigen::Matrix3d tfrac_op;
 
-    tfrac_op = lat_column_mat().inverse() * cart_op * lat_column_mat();
+    tfrac_op = inv_lat_column_mat() * cart_op * lat_column_mat();
 
     //Use a soft tolerance of 1% to see if further screening should be performed
     if(!almost_equal(1.0, std::abs(tfrac_op.determinant()), 0.01) || !is_integer(tfrac_op, 0.01)) {
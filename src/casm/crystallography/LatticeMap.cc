@@ -6,6 +6,7 @@ namespace CASM {
     m_scale(pow(std::abs(m_L2.determinant() / m_L1.determinant()), 1.0 / 3.0)), m_atomic_vol(std::abs(m_L2.determinant() / (double)num_atoms)),  m_tol(_tol), m_cost(1e20),
     m_inv_count(-std::abs(_range) * IMatType::Ones(3, 3), std::abs(_range) * IMatType::Ones(3, 3), IMatType::Ones(3, 3)) {
 
+    m_L1_inv = m_L1.inverse();
     m_U = Eigen::Matrix3d(_ideal.inv_lat_column_mat()) * m_L1;
     m_V_inv = m_L2.inverse() * Eigen::Matrix3d(_strained.lat_column_mat());
     // Initialize to first valid mapping
@@ -51,7 +52,7 @@ namespace CASM {
     m_N = DMatType::Identity(3, 3);
     // m_cache -> value of m_inv_count that gives m_N = identity;
     m_cache = m_V_inv * m_U;
-    m_F = m_L2 * m_cache * m_L1.inverse();
+    m_F = m_L2 * m_cache * m_L1_inv;
     //std::cout << "starting m_F is \n" << m_F << "  det: " << m_F.determinant() << "\n";
     double best_cost = _calc_strain_cost();
     //std::cout << "starting cost is " << m_cost << "\n";
@@ -81,10 +82,11 @@ namespace CASM {
     double tcost = max_cost;
     for(++m_inv_count; m_inv_count.valid(); ++m_inv_count) {
       //continue if determinant is not 1, because it doesn't preserve volume
-      if(!almost_equal(std::abs(m_inv_count().determinant()), 1))
+      //(the counter matrix is integer, so the check is exact)
+      if(std::abs(m_inv_count().determinant()) != 1)
         continue;
 
-      m_F = m_L2 * m_inv_count().cast<double>() * m_L1.inverse(); // -> F
+      m_F = m_L2 * m_inv_count().cast<double>() * m_L1_inv; // -> F
       tcost = _calc_strain_cost();
       if(tcost < max_cost) {
         m_cost = tcost;
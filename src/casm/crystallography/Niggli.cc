@@ -4,6 +4,96 @@
 #include "casm/misc/CASM_math.hh"
 
 namespace CASM {
+
+  namespace {
+
+    /// In-place version of ::spatial_unroll, so repeated callers can reuse
+    /// one 16-entry vector instead of allocating a fresh one per call
+    void spatial_unroll_into(const Eigen::Matrix3d &lat_mat, double compare_tol, Eigen::VectorXd &lat_spatial_descriptor) {
+      //We want to give a preference to lattices with more positive values than negative ones
+      //Count how many non-negative entries there are
+      int non_negatives = 0;
+      for(int i = 0; i < 3; i++) {
+        for(int j = 0; j < 3; j++) {
+          if(float_sgn(lat_mat(i, j), compare_tol) != -1) {
+            non_negatives++;
+          }
+        }
+      }
+
+      lat_spatial_descriptor.resize(16);
+
+      lat_spatial_descriptor <<
+                             //Favor positive values
+                             non_negatives,
+
+                             //Favor large diagonal values
+                             lat_mat(0, 0),
+                             lat_mat(1, 1),
+                             lat_mat(2, 2),
+
+                             //Favor small off diagonal values
+                             -std::abs(lat_mat(2, 1)),
+                             -std::abs(lat_mat(2, 0)),
+                             -std::abs(lat_mat(1, 0)),
+                             -std::abs(lat_mat(1, 2)),
+                             -std::abs(lat_mat(0, 2)),
+                             -std::abs(lat_mat(0, 1)),
+
+                             //Favor upper triangular
+                             float_sgn(lat_mat(2, 1), compare_tol),
+                             float_sgn(lat_mat(2, 0), compare_tol),
+                             float_sgn(lat_mat(1, 0), compare_tol),
+                             float_sgn(lat_mat(1, 2), compare_tol),
+                             float_sgn(lat_mat(0, 2), compare_tol),
+                             float_sgn(lat_mat(0, 1), compare_tol);
+    }
+
+    /// Precomputed orientation descriptors of a lattice column matrix, so the
+    /// canonicalization loops can keep the incumbent's descriptors cached
+    /// instead of re-deriving them for every candidate comparison
+    struct OrientationScore {
+      bool is_bisymmetric;
+      bool is_symmetric;
+      Eigen::VectorXd spatial;
+
+      OrientationScore() :
+        is_bisymmetric(false), is_symmetric(false) {
+      }
+
+      OrientationScore(const Eigen::Matrix3d &lat_mat, double compare_tol) :
+        is_bisymmetric(false), is_symmetric(false) {
+        assign(lat_mat, compare_tol);
+      }
+
+      /// Recompute the descriptors in place, reusing the spatial vector's
+      /// storage; lets loop bodies keep one scratch score per thread
+      void assign(const Eigen::Matrix3d &lat_mat, double compare_tol) {
+        is_bisymmetric = Eigen::is_bisymmetric(lat_mat, compare_tol);
+        is_symmetric = Eigen::is_symmetric(lat_mat, compare_tol);
+        spatial_unroll_into(lat_mat, compare_tol, spatial);
+      }
+
+      void swap(OrientationScore &other) {
+        std::swap(is_bisymmetric, other.is_bisymmetric);
+        std::swap(is_symmetric, other.is_symmetric);
+        spatial.swap(other.spatial);
+      }
+    };
+
+    /// Same tiers as ::standard_orientation_compare, evaluated on
+    /// precomputed scores: matrix symmetry first, spatial orientation
+    /// as the tie-breaker. True if 'high' is more standard than 'low'.
+    bool orientation_score_compare(const OrientationScore &low, const OrientationScore &high, double compare_tol) {
+      if((low.is_bisymmetric && !high.is_bisymmetric) || (low.is_symmetric && !high.is_symmetric)) {
+        return false;
+      }
+      if((!low.is_bisymmetric && high.is_bisymmetric) || (!low.is_symmetric && high.is_symmetric)) {
+        return true;
+      }
+      return float_lexicographical_compare(low.spatial, high.spatial, compare_tol);
+    }
+  }
   NiggliRep::NiggliRep(const Eigen::Matrix3d &init_lat_col_mat):
     m_metrical_matrix(init_lat_col_mat.transpose() * init_lat_col_mat) {
   }
@@ -248,6 +338,8 @@ namespace CASM {
 
     bool first_niggli = true;
     Eigen::Matrix3d best_lat_mat = Eigen::Matrix3d::Zero();
+    OrientationScore best_score;
+    OrientationScore candidate_score;
 
     //Like the point group, but brute forcing for every possible transformation matrix ever with determinant 1 and elements -1, 0 or 1
     const std::vector<Eigen::Matrix3i> &candidate_trans_mats = positive_unimodular_matrices();
@@ -256,8 +348,13 @@ namespace CASM {
       Eigen::Matrix3d candidate_lat_mat = reduced_in.lat_column_mat() * it->cast<double>();
 
       if(is_niggli(candidate_lat_mat, compare_tol)) {
-        if(first_niggli || standard_orientation_compare(best_lat_mat, candidate_lat_mat, compare_tol)) {
+        // the incumbent's descriptors are cached in best_score, and the
+        // candidate's are computed into a scratch score reused across
+        // iterations, so the loop allocates nothing at steady state
+        candidate_score.assign(candidate_lat_mat, compare_tol);
+        if(first_niggli || orientation_score_compare(best_score, candidate_score, compare_tol)) {
           best_lat_mat = candidate_lat_mat;
+          best_score.swap(candidate_score);
           first_niggli = false;
         }
       }
@@ -278,24 +375,61 @@ namespace CASM {
     //Ensure you at least get *something* back that's niggli AND right handed
     Lattice most_canonical = niggli(in_lat, compare_tol, false);
     Eigen::Matrix3d most_canonical_lat_mat = most_canonical.lat_column_mat();
+    OrientationScore most_canonical_score(most_canonical_lat_mat, compare_tol);
 
     Eigen::Matrix3d ref_lat_mat = most_canonical.lat_column_mat();
 
-    for(auto it = point_grp.begin(); it != point_grp.end(); ++it) {
+    // Each point-group op triggers a full niggli() pass (a scan over all
+    // positive unimodular matrices) and the iterations are independent, so
+    // this is a parallel max-reduction: every thread keeps its own running
+    // best and the bests are merged afterward. Built without -fopenmp the
+    // pragmas are ignored and the loop runs serially, with one thread-best
+    // that is merged once.
+    #pragma omp parallel
+    {
+      Eigen::Matrix3d thread_best_lat_mat = most_canonical_lat_mat;
+      OrientationScore thread_best_score = most_canonical_score;
+      OrientationScore candidate_score;
+      bool thread_improved = false;
+
+      #pragma omp for schedule(dynamic) nowait
+      for(Index i = 0; i < point_grp.size(); i++) {
+
+        //The identity op reproduces most_canonical exactly, which is already
+        //the incumbent, so don't pay a full niggli() pass to re-derive it
+        if(point_grp[i].is_identity()) {
+          continue;
+        }
+
+        Eigen::Matrix3d transformed_lat_mat = point_grp[i].matrix() * ref_lat_mat;
+        // Eigen::Matrix3d transformed_lat_mat = it->matrix() * in_lat.lat_column_mat();
 
-      Eigen::Matrix3d transformed_lat_mat = it->matrix() * ref_lat_mat;
-      // Eigen::Matrix3d transformed_lat_mat = it->matrix() * in_lat.lat_column_mat();
+        Lattice transformed_lat(transformed_lat_mat);
+        Eigen::Matrix3d candidate_lat_mat = niggli(transformed_lat, compare_tol).lat_column_mat();
 
-      Lattice transformed_lat(transformed_lat_mat);
-      Eigen::Matrix3d candidate_lat_mat = niggli(transformed_lat, compare_tol).lat_column_mat();
+        //Skip operations that change the handedness of the lattice
+        if(candidate_lat_mat.determinant() < 0.0) {
+          continue;
+        }
 
-      //Skip operations that change the handedness of the lattice
-      if(candidate_lat_mat.determinant() < 0.0) {
-        continue;
+        if(is_niggli(candidate_lat_mat, compare_tol)) {
+          candidate_score.assign(candidate_lat_mat, compare_tol);
+          if(orientation_score_compare(thread_best_score, candidate_score, compare_tol)) {
+            thread_best_lat_mat = candidate_lat_mat;
+            thread_best_score.swap(candidate_score);
+            thread_improved = true;
+          }
+        }
       }
 
-      if(is_niggli(candidate_lat_mat, compare_tol) && standard_orientation_compare(most_canonical_lat_mat, candidate_lat_mat, compare_tol)) {
-        most_canonical_lat_mat = candidate_lat_mat;
+      if(thread_improved) {
+        #pragma omp critical(casm_canonical_equivalent_lattice)
+        {
+          if(orientation_score_compare(most_canonical_score, thread_best_score, compare_tol)) {
+            most_canonical_lat_mat = thread_best_lat_mat;
+            most_canonical_score = thread_best_score;
+          }
+        }
       }
     }
 
@@ -317,45 +451,8 @@ namespace CASM {
    */
 
   Eigen::VectorXd spatial_unroll(const Eigen::Matrix3d &lat_mat, double compare_tol) {
-    //We want to give a preference to lattices with more positive values than negative ones
-    //Count how many non-negative entries there are
-    int non_negatives = 0;
-    for(int i = 0; i < 3; i++) {
-      for(int j = 0; j < 3; j++) {
-        if(float_sgn(lat_mat(i, j), compare_tol) != -1) {
-          non_negatives++;
-        }
-      }
-    }
-
-
-    Eigen::VectorXd lat_spatial_descriptor(16);
-
-    lat_spatial_descriptor <<
-                           //Favor positive values
-                           non_negatives,
-
-                           //Favor large diagonal values
-                           lat_mat(0, 0),
-                           lat_mat(1, 1),
-                           lat_mat(2, 2),
-
-                           //Favor small off diagonal values
-                           -std::abs(lat_mat(2, 1)),
-                           -std::abs(lat_mat(2, 0)),
-                           -std::abs(lat_mat(1, 0)),
-                           -std::abs(lat_mat(1, 2)),
-                           -std::abs(lat_mat(0, 2)),
-                           -std::abs(lat_mat(0, 1)),
-
-                           //Favor upper triangular
-                           float_sgn(lat_mat(2, 1), compare_tol),
-                           float_sgn(lat_mat(2, 0), compare_tol),
-                           float_sgn(lat_mat(1, 0), compare_tol),
-                           float_sgn(lat_mat(1, 2), compare_tol),
-                           float_sgn(lat_mat(0, 2), compare_tol),
-                           float_sgn(lat_mat(0, 1), compare_tol);
-
+    Eigen::VectorXd lat_spatial_descriptor;
+    spatial_unroll_into(lat_mat, compare_tol, lat_spatial_descriptor);
     return lat_spatial_descriptor;
   }
 
@@ -389,26 +486,9 @@ namespace CASM {
    */
 
   bool standard_orientation_compare(const Eigen::Matrix3d &low_score_lat_mat, const Eigen::Matrix3d &high_score_lat_mat, double compare_tol) {
-    bool low_score_is_symmetric = Eigen::is_symmetric(low_score_lat_mat, compare_tol);
-    bool low_score_is_bisymmetric = Eigen::is_bisymmetric(low_score_lat_mat, compare_tol);
-
-    bool high_score_is_symmetric = Eigen::is_symmetric(high_score_lat_mat, compare_tol);
-    bool high_score_is_bisymmetric = Eigen::is_bisymmetric(high_score_lat_mat, compare_tol);
-
-    //The high_score is less symmetric than the low score, therefore high<low
-    if((low_score_is_bisymmetric && !high_score_is_bisymmetric) || (low_score_is_symmetric && !high_score_is_symmetric)) {
-      return false;
-    }
-
-    //The high_score is more symmetric than the low_score, therefore high>low automatically (matrix symmetry trumps spatial orientation)
-    else if((!low_score_is_bisymmetric && high_score_is_bisymmetric) || (!low_score_is_symmetric && high_score_is_symmetric)) {
-      return true;
-    }
-
-    //If you made it here then the high_score and the low_score have the same symmetry level, so we check for the spatial orientation
-    else {
-      return standard_orientation_spatial_compare(low_score_lat_mat, high_score_lat_mat, compare_tol);
-    }
+    return orientation_score_compare(OrientationScore(low_score_lat_mat, compare_tol),
+                                     OrientationScore(high_score_lat_mat, compare_tol),
+                                     compare_tol);
   }
 
 }
@@ -19,7 +19,8 @@ namespace CASM {
 
     m_NB = NB;
 
-    Eigen::Matrix3d dtrans_mat(p_lat.lat_column_mat().inverse()*s_lat.lat_column_mat());
+    //the prim lattice already caches its inverse
+    Eigen::Matrix3d dtrans_mat(p_lat.inv_lat_column_mat()*s_lat.lat_column_mat());
 
     for(int i = 0; i < 3; i++) {
       for(int j = 0; j < 3; j++) {
@@ -91,7 +92,8 @@ namespace CASM {
 
     m_NB = NB;
 
-    Eigen::Matrix3d dtrans_mat(p_lat.lat_column_mat().inverse()*s_lat.lat_column_mat());
+    //the prim lattice already caches its inverse
+    Eigen::Matrix3d dtrans_mat(p_lat.inv_lat_column_mat()*s_lat.lat_column_mat());
 
     for(int i = 0; i < 3; i++) {
       for(int j = 0; j < 3; j++) {
@@ -197,15 +199,62 @@ namespace CASM {
   /// right hand side must be also.  Moreover, the elements of the RHS should
   /// be on the interval [0,m_N_vol-1] if it is within the supercell.
 
+  namespace {
+    /// Map 'val' onto [0, modulus-1]. One division plus a conditional add,
+    /// rather than the two divisions of ((val % modulus) + modulus) % modulus
+    inline long positive_mod(long val, long modulus) {
+      long rem = val % modulus;
+      if(rem < 0)
+        rem += modulus;
+      return rem;
+    }
+  }
+
   UnitCellCoord PrimGrid::get_within(const UnitCellCoord &bijk)const {
 
-    vector_type vec2 = m_plane_mat * bijk.unitcell();
+    // open-coded 3x3 * 3x1 integer products keep everything in registers on
+    // this hot path, instead of round-tripping through Eigen temporaries
+    const matrix_type &P(m_plane_mat);
+    const matrix_type &T(m_trans_mat);
+    const long i = bijk[1], j = bijk[2], k = bijk[3];
 
-    vec2[0] = ((vec2[0] % m_N_vol) + m_N_vol) % m_N_vol;
-    vec2[1] = ((vec2[1] % m_N_vol) + m_N_vol) % m_N_vol;
-    vec2[2] = ((vec2[2] % m_N_vol) + m_N_vol) % m_N_vol;
+    const long v0 = positive_mod(P(0, 0) * i + P(0, 1) * j + P(0, 2) * k, m_N_vol);
+    const long v1 = positive_mod(P(1, 0) * i + P(1, 1) * j + P(1, 2) * k, m_N_vol);
+    const long v2 = positive_mod(P(2, 0) * i + P(2, 1) * j + P(2, 2) * k, m_N_vol);
 
-    return UnitCellCoord(bijk[0], (m_trans_mat * vec2) / m_N_vol);
+    return UnitCellCoord(bijk[0],
+                         (T(0, 0) * v0 + T(0, 1) * v1 + T(0, 2) * v2) / m_N_vol,
+                         (T(1, 0) * v0 + T(1, 1) * v1 + T(1, 2) * v2) / m_N_vol,
+                         (T(2, 0) * v0 + T(2, 1) * v1 + T(2, 2) * v2) / m_N_vol);
+  }
+
+  //**********************************************************************************************
+
+  /// Batched form of get_within(). One pass over the array keeps the nine
+  /// adjugate and transformation entries hot and lets the compiler vectorize
+  /// across cells, which matters when bringing entire site lists within.
+  void PrimGrid::get_within(Array<UnitCellCoord> &bijk_array)const {
+
+    const matrix_type &P(m_plane_mat);
+    const matrix_type &T(m_trans_mat);
+    const Index N = bijk_array.size();
+
+    // Iterations are independent (each touches only bijk_array[n] and const
+    // members), so the loop may be parallelized when built with -fopenmp;
+    // without it the pragma is ignored and the loop runs serially as before.
+    #pragma omp parallel for schedule(static)
+    for(Index n = 0; n < N; n++) {
+      UnitCellCoord &bijk(bijk_array[n]);
+      const long i = bijk[1], j = bijk[2], k = bijk[3];
+
+      const long v0 = positive_mod(P(0, 0) * i + P(0, 1) * j + P(0, 2) * k, m_N_vol);
+      const long v1 = positive_mod(P(1, 0) * i + P(1, 1) * j + P(1, 2) * k, m_N_vol);
+      const long v2 = positive_mod(P(2, 0) * i + P(2, 1) * j + P(2, 2) * k, m_N_vol);
+
+      bijk[1] = (T(0, 0) * v0 + T(0, 1) * v1 + T(0, 2) * v2) / m_N_vol;
+      bijk[2] = (T(1, 0) * v0 + T(1, 1) * v1 + T(1, 2) * v2) / m_N_vol;
+      bijk[3] = (T(2, 0) * v0 + T(2, 1) * v1 + T(2, 2) * v2) / m_N_vol;
+    }
   }
 
   //**********************************************************************************************
@@ -235,10 +284,14 @@ namespace CASM {
   UnitCellCoord PrimGrid::uccoord(Index i)const {
     assert(i >= 0 && i < m_N_vol && "PrimGrid::uccoord(Index i) -> index 'i' out of range!");
 
-    UnitCellCoord bmnp(-1,
-                       (i % m_stride[1]) % m_stride[0],
-                       (i % m_stride[1]) / m_stride[0],
-                       i / m_stride[1]);
+    // two divisions and two multiply-subtracts, instead of a fresh division
+    // for each of the three (m,n,p) components
+    const Index p = i / m_stride[1];
+    const Index rem = i - p * m_stride[1];
+    const Index n = rem / m_stride[0];
+    const Index m = rem - n * m_stride[0];
+
+    UnitCellCoord bmnp(-1, m, n, p);
     return from_canonical(bmnp);
   }
 
@@ -278,7 +331,7 @@ namespace CASM {
 
           //map within bounds
           for(int i = 0; i < 3; i++) {
-            new_mnp[i] = ((new_mnp[i] % m_S[i]) + m_S[i]) % m_S[i];
+            new_mnp[i] = positive_mod(new_mnp[i], m_S[i]);
           }
 
           old_l = mnp_count[0] + mnp_count[1] * m_stride[0] + mnp_count[2] * m_stride[1] + nb * size();
@@ -314,14 +367,16 @@ namespace CASM {
     Index new_l;
     for(Index shift_l = 0; shift_l < size(); shift_l++) {
       //shift_bmnp describes translation by uccoord(shift_l)
-      shift_bmnp[1] = (shift_l % m_stride[1]) % m_stride[0];
-      shift_bmnp[2] = (shift_l % m_stride[1]) / m_stride[0];
-      shift_bmnp[3] =   shift_l / m_stride[1];
+      shift_bmnp[3] = shift_l / m_stride[1];
+      const Index shift_rem = shift_l - shift_bmnp[3] * m_stride[1];
+      shift_bmnp[2] = shift_rem / m_stride[0];
+      shift_bmnp[1] = shift_rem - shift_bmnp[2] * m_stride[0];
       //std::cerr << "shift_bmnp " << shift_l << " is " << shift_bmnp;
       for(Index old_l = 0; old_l < size(); old_l++) {
-        bmnp[1] = (old_l % m_stride[1]) % m_stride[0];
-        bmnp[2] = (old_l % m_stride[1]) / m_stride[0];
         bmnp[3] = old_l / m_stride[1];
+        const Index old_rem = old_l - bmnp[3] * m_stride[1];
+        bmnp[2] = old_rem / m_stride[0];
+        bmnp[1] = old_rem - bmnp[2] * m_stride[0];
         //std::cerr << "old_bmnp " << old_l << " is " << bmnp;
 
         bmnp[1] = (bmnp[1] + shift_bmnp[1]) % m_S[0];
@@ -352,7 +407,7 @@ namespace CASM {
         bmnp[i + 1] += m_invU(i, j) * bijk[j + 1];
       }
       //Map within bounds
-      bmnp[i + 1] = ((bmnp[i + 1] % m_S[i]) + m_S[i]) % m_S[i];
+      bmnp[i + 1] = positive_mod(bmnp[i + 1], m_S[i]);
     }
 
     return bmnp;
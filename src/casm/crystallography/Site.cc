@@ -211,6 +211,7 @@ namespace CASM {
 
   Array<std::string> Site::allowed_occupants() const {
     Array<std::string> occ_list;
+    occ_list.reserve(site_occupant().size());
     for(Index i = 0; i < site_occupant().size(); i++) {
       occ_list.push_back(site_occupant()[i].name);
     }
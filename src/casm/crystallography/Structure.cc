@@ -168,10 +168,12 @@ namespace CASM {
     // get Molecule allowed in prim, and how many there are
     std::vector<Molecule> struc_mol = get_struc_molecule();
 
-    // store Molecule names in vector
+    // store Molecule names in vector; struc_mol is a local copy, so the
+    // names can be moved out instead of reallocated
     std::vector<std::string> struc_mol_name;
+    struc_mol_name.reserve(struc_mol.size());
     for(int i = 0; i < struc_mol.size(); i++) {
-      struc_mol_name.push_back(struc_mol[i].name);
+      struc_mol_name.push_back(std::move(struc_mol[i].name));
     }
 
     return struc_mol_name;
@@ -210,8 +210,16 @@ namespace CASM {
 
       //Use the given attempt as a starting guess for factorizing the element at position,
       //but if that doesn't work, keep increasing the value of the attempt until it does.
+      //An odd value has no even factors, so in that case only odd attempts need testing.
+      HermiteCounter::value_type attempt_step = 1;
+      if(diag(position) % 2 != 0) {
+        attempt_step = 2;
+        if(attempt % 2 == 0) {
+          attempt++;
+        }
+      }
       while(diag(position) % attempt != 0) {
-        attempt++;
+        attempt += attempt_step;
       }
 
       diag(position) = diag(position) / attempt;
@@ -251,13 +259,8 @@ namespace CASM {
     HermiteCounter::Index upper_size(HermiteCounter::Index init_dim) {
       assert(init_dim > 0);
 
-      HermiteCounter::Index tritotal = 0;
-
-      for(int i = 0; i < init_dim; i++) {
-        tritotal += i;
-      }
-
-      return tritotal;
+      //number of elements above the diagonal is the (init_dim - 1)th triangular number
+      return init_dim * (init_dim - 1) / 2;
     }
 
     EigenVectorXiCounter _upper_tri_counter(const Eigen::VectorXi &current_diag) {
@@ -412,6 +415,12 @@ namespace CASM {
       Index n = H.rows();
       Index m = G.rows();
 
+      //In the common full-dimensional case there are no extra dimensions to
+      //insert, so B == H and the block assembly below can be skipped
+      if(n == m) {
+        return G * H;
+      }
+
       //First convert H into a block matrix with dimensions m x m, the H block is on the upper left
       Eigen::MatrixXi B(m, m);
       Eigen::MatrixXi I_block(Eigen::MatrixXi::Identity(m - n, m - n));
@@ -444,11 +453,7 @@ namespace CASM {
       assert(hermit_mat.rows() == hermit_mat.cols());
 
       int dims = hermit_mat.rows();
-      int unrolldim = 0;
-
-      for(int i = dims; i > 0; i--) {
-        unrolldim += i;
-      }
+      int unrolldim = dims * (dims + 1) / 2;
 
       Eigen::VectorXi unrolled_herm(unrolldim);
 
@@ -541,7 +546,7 @@ namespace CASM {
 
 
   template<>
-  SupercellEnumerator<Lattice>::SupercellEnumerator(Lattice unit,
+  SupercellEnumerator<Lattice>::SupercellEnumerator(const Lattice &unit,
                                                     const ScelEnumProps &enum_props,
                                                     double tol) :
     m_unit(unit),
@@ -555,12 +560,20 @@ namespace CASM {
       throw std::runtime_error("The transformation matrix to expand into a 3x3 matrix must have a positive determinant!");
     }
 
+    if(m_begin_volume > m_end_volume) {
+      throw std::runtime_error("The beginning volume of the SupercellEnumerator cannot be greater than the end volume!");
+    }
+
+    if(m_dims < 1) {
+      throw std::runtime_error("Dimensions to count over must be greater than 0!");
+    }
+
     m_lat.generate_point_group(m_point_group, tol);
 
   }
 
   template<>
-  SupercellEnumerator<Lattice>::SupercellEnumerator(Lattice unit,
+  SupercellEnumerator<Lattice>::SupercellEnumerator(const Lattice &unit,
                                                     const SymGroup &point_grp,
                                                     const ScelEnumProps &enum_props) :
     m_unit(unit),
@@ -574,6 +587,14 @@ namespace CASM {
     if(m_gen_mat.determinant() < 1) {
       throw std::runtime_error("The transformation matrix to expand into a 3x3 matrix must have a positive determinant!");
     }
+
+    if(m_begin_volume > m_end_volume) {
+      throw std::runtime_error("The beginning volume of the SupercellEnumerator cannot be greater than the end volume!");
+    }
+
+    if(m_dims < 1) {
+      throw std::runtime_error("Dimensions to count over must be greater than 0!");
+    }
   }
 
 
@@ -607,13 +628,21 @@ namespace CASM {
         return (L.transpose() * L).trace();
       };
 
-      auto compare = [&](const Lattice & A, const Lattice & B) {
-        return compactness(A) < compactness(B);
-      };
-
+      //track the best score alongside the best matrix, so each candidate
+      //supercell is scored once (std::min_element re-evaluates the
+      //incumbent's compactness for every comparison)
       SupercellEnumerator<Lattice> scel(unit, point_grp, ScelEnumProps(m, m + 1));
-      auto best_it = std::min_element(scel.begin(), scel.end(), compare);
-      return best_it.matrix();
+      auto it = scel.begin();
+      Eigen::Matrix3i best_mat = it.matrix();
+      double best_score = compactness(*it);
+      for(++it; it != scel.end(); ++it) {
+        double score = compactness(*it);
+        if(score < best_score) {
+          best_score = score;
+          best_mat = it.matrix();
+        }
+      }
+      return best_mat;
     }
 
   }
@@ -651,7 +680,10 @@ namespace CASM {
   /// \relatesalso Lattice
   ///
   Eigen::Matrix3i canonical_hnf(const Eigen::Matrix3i &T, const SymGroup &effective_pg, const Lattice &ref_lattice) {
-    Eigen::Matrix3d lat = ref_lattice.lat_column_mat();
+    const Eigen::Matrix3d &lat = ref_lattice.lat_column_mat();
+    //the inverse is already cached by the Lattice, so don't recompute it for
+    //every point group operation
+    const Eigen::Matrix3d &inv_lat = ref_lattice.inv_lat_column_mat();
 
     //get T in hermite normal form
     //H is the canonical form of the initial T matrix
@@ -661,13 +693,26 @@ namespace CASM {
     Eigen::Matrix3i H_best;
     H_best = H;
 
+    //keep the unrolled comparison key of the incumbent around, so that each
+    //candidate is unrolled once instead of re-unrolling H_best for every
+    //point group operation
+    Eigen::VectorXi unrolled_best = HermiteCounter_impl::_canonical_unroll(H_best);
+
     for(Index i = 0; i < effective_pg.size(); i++) {
-      Eigen::Matrix3i transformed = iround(lat.inverse() * effective_pg[i].matrix() * lat) * H;
+      Eigen::Matrix3i transformed = iround(inv_lat * effective_pg[i].matrix() * lat) * H;
       Eigen::Matrix3i H_transformed = hermite_normal_form(transformed).first;
+      Eigen::VectorXi unrolled_transformed = HermiteCounter_impl::_canonical_unroll(H_transformed);
 
       //If you fall in here then transformed was greater than H
-      if(HermiteCounter_impl::_canonical_compare(H_best, H_transformed) == 1) {
-        H_best = H_transformed;
+      for(Index j = 0; j < unrolled_best.size(); j++) {
+        if(unrolled_best(j) < unrolled_transformed(j)) {
+          H_best = H_transformed;
+          unrolled_best = unrolled_transformed;
+          break;
+        }
+        else if(unrolled_best(j) > unrolled_transformed(j)) {
+          break;
+        }
       }
     }
 
@@ -1,3 +1,5 @@
+#include <algorithm>
+
 #include "casm/monte_carlo/Conversions.hh"
 #include "casm/clex/PrimClex.hh"
 #include "casm/clex/Supercell.hh"
@@ -43,12 +45,27 @@ namespace CASM {
       m_Nasym = asym;
 
       // make m_asym_to_unitl & m_asym_to_b
+      // each unitl belongs to exactly one asym unit and the loop visits them
+      // in ascending order, so m_asym_to_unitl is sorted & unique as built;
+      // m_asym_to_b may collect duplicates and is sorted afterwards
       m_asym_to_unitl.resize(m_Nasym);
       m_asym_to_b.resize(m_Nasym);
       for(Index unitl = 0; unitl < unit_Nsites; ++unitl) {
         Index asym = m_unitl_to_asym[unitl];
-        m_asym_to_unitl[asym].insert(unitl);
-        m_asym_to_b[asym].insert(unitl_to_b(unitl));
+        m_asym_to_unitl[asym].push_back(unitl);
+        m_asym_to_b[asym].push_back(unitl_to_b(unitl));
+      }
+      for(Index asym = 0; asym < m_Nasym; ++asym) {
+        auto &b_list = m_asym_to_b[asym];
+        std::sort(b_list.begin(), b_list.end());
+        b_list.erase(std::unique(b_list.begin(), b_list.end()), b_list.end());
+      }
+
+      // make m_l_to_unitl
+      Index Nsites = m_mc_scel->num_sites();
+      m_l_to_unitl.reserve(Nsites);
+      for(Index l = 0; l < Nsites; ++l) {
+        m_l_to_unitl.push_back(bijk_to_unitl(l_to_bijk(l)));
       }
 
       // make m_occ_to_species and m_species_to_occ
@@ -62,7 +79,7 @@ namespace CASM {
       m_occ_to_species.resize(m_Nasym);
       m_species_to_occ.resize(m_Nasym);
       for(Index asym = 0; asym < m_Nasym; ++asym) {
-        Index b = *(m_asym_to_b[asym].begin());
+        Index b = m_asym_to_b[asym].front();
         m_occ_to_species[asym] = index_converter[b];
         m_species_to_occ[asym] = index_converter_inv[b];
       }
@@ -78,10 +95,10 @@ namespace CASM {
       return m_mc_scel->uccoord(l);
     }
     Index Conversions::l_to_unitl(Index l) const {
-      return bijk_to_unitl(l_to_bijk(l));
+      return m_l_to_unitl[l];
     }
     Index Conversions::l_to_asym(Index l) const {
-      return m_unitl_to_asym[l_to_unitl(l)];
+      return m_unitl_to_asym[m_l_to_unitl[l]];
     }
 
     Index Conversions::bijk_to_l(const UnitCellCoord &bijk) const {
@@ -107,10 +124,10 @@ namespace CASM {
     Index Conversions::asym_size() const {
       return m_Nasym;
     }
-    const std::set<Index> &Conversions::asym_to_b(Index asym) const {
+    const std::vector<Index> &Conversions::asym_to_b(Index asym) const {
       return m_asym_to_b[asym];
     }
-    const std::set<Index> &Conversions::asym_to_unitl(Index asym) const {
+    const std::vector<Index> &Conversions::asym_to_unitl(Index asym) const {
       return m_asym_to_unitl[asym];
     }
 
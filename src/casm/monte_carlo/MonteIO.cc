@@ -221,6 +221,7 @@ namespace CASM {
       auto formatter = make_observation_formatter(mc);
 
       std::vector<std::pair<ConstMonteCarloPtr, Index> > observations;
+      observations.reserve(mc.sample_times().size());
       ConstMonteCarloPtr ptr = &mc;
       for(MonteSampler::size_type i = 0; i < mc.sample_times().size(); ++i) {
         observations.push_back(std::make_pair(ptr, i));
@@ -279,6 +280,7 @@ namespace CASM {
       const Structure &prim = mc.primclex().get_prim();
 
       std::vector<std::pair<ConstMonteCarloPtr, Index> > observations;
+      observations.reserve(mc.sample_times().size());
       ConstMonteCarloPtr ptr = &mc;
       for(MonteSampler::size_type i = 0; i < mc.sample_times().size(); ++i) {
         observations.push_back(std::make_pair(ptr, i));
@@ -290,10 +292,15 @@ namespace CASM {
         sout << formatter(observations.cbegin(), observations.cend());
         sout.close();
 
+        // allowed_occupants() builds a fresh name list on every call, so
+        // collect it once per basis site for the loops below
+        std::vector<Array<std::string> > allowed;
+        allowed.reserve(prim.basis.size());
         int max_allowed = 0;
         for(int i = 0; i < prim.basis.size(); i++) {
-          if(prim.basis[i].allowed_occupants().size() > max_allowed) {
-            max_allowed = prim.basis[i].allowed_occupants().size();
+          allowed.push_back(prim.basis[i].allowed_occupants());
+          if(allowed.back().size() > max_allowed) {
+            max_allowed = allowed.back().size();
           }
         }
 
@@ -314,8 +321,8 @@ namespace CASM {
         for(int i = 0; i < prim.basis.size(); i++) {
           keyout << i;
           for(int j = 0; j < max_allowed; j++) {
-            if(j < prim.basis[i].allowed_occupants().size()) {
-              keyout << "\t" << prim.basis[i].allowed_occupants()[j];
+            if(j < allowed[i].size()) {
+              keyout << "\t" << allowed[i][j];
             }
             else {
               keyout << "\t-";
@@ -330,15 +337,21 @@ namespace CASM {
       if(settings.write_json()) {
 
         jsonParser json = jsonParser::object();
-        json["Pass"] = jsonParser::array();
-        json["Step"] = jsonParser::array();
-        json["DoF"] = jsonParser::array();
+        jsonParser &pass_json = json["Pass"];
+        jsonParser &step_json = json["Step"];
+        jsonParser &dof_json = json["DoF"];
+        pass_json = jsonParser::array();
+        step_json = jsonParser::array();
+        dof_json = jsonParser::array();
+        pass_json.get_array().reserve(mc.sample_times().size());
+        step_json.get_array().reserve(mc.sample_times().size());
+        dof_json.get_array().reserve(mc.trajectory().size());
         for(auto it = mc.sample_times().cbegin(); it != mc.sample_times().cend(); ++it) {
-          json["Pass"].push_back(it->first);
-          json["Step"].push_back(it->second);
+          pass_json.push_back(it->first);
+          step_json.push_back(it->second);
         }
         for(auto it = mc.trajectory().cbegin(); it != mc.trajectory().cend(); ++it) {
-          json["DoF"].push_back(*it);
+          dof_json.push_back(*it);
         }
         gz::ogzstream sout((dir.trajectory_json(cond_index).string() + ".gz").c_str());
         _log << "write: " << fs::path(dir.trajectory_json(cond_index).string() + ".gz") << "\n";
@@ -350,6 +363,7 @@ namespace CASM {
         // [["A", "B"],["A" "C"], ... ]
 
         jsonParser key = jsonParser::array();
+        key.get_array().reserve(prim.basis.size());
         for(int i = 0; i < prim.basis.size(); i++) {
           key.push_back(prim.basis[i].allowed_occupants());
         }
@@ -24,10 +24,15 @@ namespace CASM {
         vec.clear();
       }
 
+      // resolve each site's asymmetric-unit index once, shared by the
+      // counting pass and the fill pass below
+      std::vector<Index> l_to_asym;
+      l_to_asym.reserve(config.size());
+
       Index Nmut = 0;
       for(Index l = 0; l < config.size(); ++l) {
-        Index asym = m_convert.l_to_asym(l);
-        if(m_convert.occ_size(asym) > 1) {
+        l_to_asym.push_back(m_convert.l_to_asym(l));
+        if(m_convert.occ_size(l_to_asym.back()) > 1) {
           Nmut++;
         }
       }
@@ -36,7 +41,7 @@ namespace CASM {
       m_l_to_mol.reserve(config.size());
       Index mol_id = 0;
       for(Index l = 0; l < config.size(); ++l) {
-        Index asym = m_convert.l_to_asym(l);
+        Index asym = l_to_asym[l];
         if(m_convert.occ_size(asym) > 1) {
           Index species_index = m_convert.species_index(asym, config.occ(l));
           Index cand_index = m_cand.index(asym, species_index);
@@ -1,5 +1,7 @@
 #include "casm/monte_carlo/SiteExchanger.hh"
 
+#include <map>
+
 #include "casm/clex/Supercell.hh"
 #include "casm/clex/PrimClex.hh"
 
@@ -109,6 +111,14 @@ namespace CASM {
     int prim_basis = scel.get_prim().basis.size();
     std::vector<std::string> allowed_components = scel.get_primclex().composition_axes().components();
 
+    //Index of each allowed component name, built once so that the occupant
+    //lookups below are a single map find instead of a linear scan over the
+    //component strings for every occupant of every sublattice
+    std::map<std::string, int> component_index;
+    for(int i = 0; i < allowed_components.size(); i++) {
+      component_index[allowed_components[i]] = i;
+    }
+
     //Count over sites in prim basis.
     for(Index prim_basis_site = 0; prim_basis_site < prim_basis; prim_basis_site++) {
 
@@ -140,18 +150,18 @@ namespace CASM {
           single_possible_swap.push_back(swaps);
 
           //For site_to_mol we want a way to translate what possible_curr_occ means in terms of allowed components at the PrimClex level
-          int mol_ind = std::find(allowed_components.cbegin(), allowed_components.cend(), site_allowed_occ[possible_curr_occ]) - allowed_components.cbegin();
+          auto comp_it = component_index.find(site_allowed_occ[possible_curr_occ]);
 
           //This should never ever happen
-          if(mol_ind == allowed_components.size()) {
+          if(comp_it == component_index.end()) {
             std::cerr << "ERROR in Monte::populate_occ_exchange_tables" << std::endl;
             std::cerr << "The possible components are " << allowed_components << std::endl;
-            std::cerr << "Could not find " << allowed_components[possible_curr_occ] << " in the allowed components of the PrimClex prim." << std::endl;
+            std::cerr << "Could not find " << site_allowed_occ[possible_curr_occ] << " in the allowed components of the PrimClex prim." << std::endl;
             exit(9000);
           }
 
           //Save the index into allowed_components
-          single_site_to_mol.push_back(mol_ind);
+          single_site_to_mol.push_back(comp_it->second);
         }
 
         //possible_swap has blocks of identical double arrays single_possible_swap. They get pushed back the appropriate amount of times here
@@ -182,11 +192,11 @@ namespace CASM {
         std::vector<int> single_site_to_mol;
 
         //The one and only allowed occupant at prim_basis_site must be
-        std::string only_site_occ = scel.get_prim().basis[prim_basis_site].allowed_occupants()[0];
+        const std::string &only_site_occ = site_allowed_occ[0];
 
         //And the corresponding index for that occupant in terms of allowed_components is
-        int mol_ind = std::find(allowed_components.cbegin(), allowed_components.cend(), only_site_occ) - allowed_components.cbegin();
-        if(mol_ind == allowed_components.size()) {
+        auto comp_it = component_index.find(only_site_occ);
+        if(comp_it == component_index.end()) {
           std::cerr << "ERROR in Monte::populate_occ_exchange_tables" << std::endl;
           std::cerr << "The possible components are " << allowed_components << std::endl;
           std::cerr << "Could not find " << only_site_occ << " in the allowed components of the PrimClex prim." << std::endl;
@@ -198,7 +208,7 @@ namespace CASM {
         m_possible_swap.push_back(single_possible_swap);
 
         //Put that single value we found into the array
-        single_site_to_mol.push_back(mol_ind);
+        single_site_to_mol.push_back(comp_it->second);
 
         m_sublat_to_mol.push_back(single_site_to_mol);
 
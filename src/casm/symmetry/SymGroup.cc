@@ -257,7 +257,7 @@ namespace CASM {
       // rp = rotation parameter
       Eigen::Matrix3d coord_rep_mat = at(i).matrix();
       if(!almost_equal(coord_rep_mat.determinant(), 1.)) {
-        std::cout << "IN IF" << std::endl;
+        //std::cout << "IN IF" << std::endl;
         coord_rep_mat *= coord_rep_mat.determinant();
         //continue;
       }
@@ -327,14 +327,14 @@ namespace CASM {
       left_q(3, 3) =  opq.w();
 
 
-      std::cout << right_q << std::endl;
+      //std::cout << right_q << std::endl;
 
       new_rep->set_rep(i, SymMatrixXd(left_q));
     }
 
-    for(Index i = 0 ; i < new_rep->size() ; i++) {
-      std::cout << "Rota Rep final mats " << i << "\n" << *(new_rep->get_MatrixXd(i)) << std::endl;
-    }
+    //for(Index i = 0 ; i < new_rep->size() ; i++) {
+    //  std::cout << "Rota Rep final mats " << i << "\n" << *(new_rep->get_MatrixXd(i)) << std::endl;
+    //}
 
     return _add_representation(new_rep);
   }